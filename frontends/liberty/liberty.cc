@@ -428,6 +428,14 @@ struct LibertyFrontend : public Frontend {
 		log("    -setattr <attribute_name>\n");
 		log("        set the specified attribute (to the value 1) on all loaded modules\n");
 		log("\n");
+		log("    -cache <cache_file>\n");
+		log("        store the cells, pins and functions read from the liberty file in\n");
+		log("        the given cache file and read them from there as long as the\n");
+		log("        liberty file is unchanged. (the cache file can be shared with\n");
+		log("        dfflibmap -cache.)\n");
+		log("\n");
+		log("Timing and power groups are skipped while reading the liberty file.\n");
+		log("\n");
 	}
 	virtual void execute(std::istream *&f, std::string filename, std::vector<std::string> args, RTLIL::Design *design)
 	{
@@ -436,6 +444,7 @@ struct LibertyFrontend : public Frontend {
 		bool flag_ignore_miss_func = false;
 		bool flag_ignore_miss_dir  = false;
 		std::vector<std::string> attributes;
+		std::string cache_file;
 
 		log_header("Executing Liberty frontend.\n");
 
@@ -462,11 +471,15 @@ struct LibertyFrontend : public Frontend {
 				attributes.push_back(RTLIL::escape_id(args[++argidx]));
 				continue;
 			}
+			if (arg == "-cache" && argidx+1 < args.size()) {
+				cache_file = args[++argidx];
+				continue;
+			}
 			break;
 		}
 		extra_args(f, filename, args, argidx);
 
-		LibertyParser parser(*f);
+		LibertyParser parser(*f, filename, cache_file);
 		int cell_count = 0;
 
 		for (auto cell : parser.ast->children)
@@ -40,191 +40,242 @@
 
 YOSYS_NAMESPACE_BEGIN
 
-static std::list<std::string> output_code;
-static std::list<std::string> input_buffer;
-static size_t input_buffer_charp;
+std::set<std::string> verilog_include_files;
 
-static void return_char(char ch)
-{
-	if (input_buffer_charp == 0)
-		input_buffer.push_front(std::string() + ch);
-	else
-		input_buffer.front()[--input_buffer_charp] = ch;
-}
+// The preprocessor is a std::streambuf that produces its output on demand, so that the lexer can
+// consume preprocessed code while the rest of the input is still being processed. Input is kept
+// as a stack of chunks: included files, expanded macros and returned characters are pushed to the
+// front, and each chunk has its own read position so pushing never copies the remaining input.
+// Everything in the stack precedes the unread part of the main input file, which is therefore
+// only read block by block when the stack runs empty.
 
-static void insert_input(std::string str)
+struct VerilogPreproc : std::streambuf
 {
-	if (input_buffer_charp != 0) {
-		input_buffer.front() = input_buffer.front().substr(input_buffer_charp);
-		input_buffer_charp = 0;
+	struct input_chunk_t {
+		std::string text;
+		size_t pos;
+		input_chunk_t(const std::string &text) : text(text), pos(0) { }
+	};
+
+	std::string filename;
+	std::list<std::string> include_dirs;
+	std::map<std::string, std::string> defines_map;
+	std::set<std::string> defines_with_args;
+	int ifdef_fail_level;
+	bool in_elseif;
+
+	std::list<input_chunk_t> input_buffer;
+	std::istream *input_stream;
+	std::vector<char> input_block;
+	std::map<std::string, std::string> include_cache;
+	std::string output_code, output_buffer;
+
+	VerilogPreproc(std::istream &f, std::string filename, const std::map<std::string, std::string> &pre_defines_map,
+			const std::list<std::string> &include_dirs) : filename(filename), include_dirs(include_dirs),
+			defines_map(pre_defines_map), ifdef_fail_level(0), in_elseif(false), input_stream(NULL)
+	{
+		input_file(f, filename);
+		defines_map["YOSYS"] = "1";
+		defines_map["SYNTHESIS"] = "1";
 	}
-	input_buffer.push_front(str);
-}
-
-static char next_char()
-{
-	if (input_buffer.empty())
-		return 0;
 
-	log_assert(input_buffer_charp <= input_buffer.front().size());
-	if (input_buffer_charp == input_buffer.front().size()) {
-		input_buffer_charp = 0;
-		input_buffer.pop_front();
-		return next_char();
+	void return_char(char ch)
+	{
+		if (input_buffer.empty() || input_buffer.front().pos == 0)
+			input_buffer.push_front(input_chunk_t(std::string() + ch));
+		else
+			input_buffer.front().text[--input_buffer.front().pos] = ch;
 	}
 
-	char ch = input_buffer.front()[input_buffer_charp++];
-	return ch == '\r' ? next_char() : ch;
-}
+	void insert_input(std::string str)
+	{
+		input_buffer.push_front(input_chunk_t(str));
+	}
 
-static std::string skip_spaces()
-{
-	std::string spaces;
-	while (1) {
-		char ch = next_char();
-		if (ch == 0)
-			break;
-		if (ch != ' ' && ch != '\t') {
-			return_char(ch);
-			break;
+	bool input_empty()
+	{
+		while (input_buffer.empty() && input_stream != NULL) {
+			int rc = readsome(*input_stream, input_block.data(), GetSize(input_block));
+			if (rc > 0) {
+				input_buffer.push_back(input_chunk_t(std::string(input_block.data(), rc)));
+			} else {
+				input_buffer.push_back(input_chunk_t("\n`file_pop\n"));
+				input_stream = NULL;
+			}
 		}
-		spaces += ch;
+		return input_buffer.empty();
 	}
-	return spaces;
-}
-
-static std::string next_token(bool pass_newline = false)
-{
-	std::string token;
 
-	char ch = next_char();
-	if (ch == 0)
-		return token;
+	char next_char()
+	{
+		while (!input_empty())
+		{
+			input_chunk_t &chunk = input_buffer.front();
+			log_assert(chunk.pos <= chunk.text.size());
+
+			if (chunk.pos == chunk.text.size()) {
+				input_buffer.pop_front();
+				continue;
+			}
 
-	token += ch;
-	if (ch == '\n') {
-		if (pass_newline) {
-			output_code.push_back(token);
-			return "";
+			char ch = chunk.text[chunk.pos++];
+			if (ch != '\r')
+				return ch;
 		}
-		return token;
+
+		return 0;
 	}
-	
-	if (ch == ' ' || ch == '\t')
+
+	std::string skip_spaces()
 	{
-		while ((ch = next_char()) != 0) {
+		std::string spaces;
+		while (1) {
+			char ch = next_char();
+			if (ch == 0)
+				break;
 			if (ch != ' ' && ch != '\t') {
 				return_char(ch);
 				break;
 			}
-			token += ch;
+			spaces += ch;
 		}
+		return spaces;
 	}
-	else if (ch == '"')
+
+	std::string next_token(bool pass_newline = false)
 	{
-		while ((ch = next_char()) != 0) {
-			token += ch;
-			if (ch == '"')
-				break;
-			if (ch == '\\') {
-				if ((ch = next_char()) != 0)
-					token += ch;
+		std::string token;
+
+		char ch = next_char();
+		if (ch == 0)
+			return token;
+
+		token += ch;
+		if (ch == '\n') {
+			if (pass_newline) {
+				output_code += token;
+				return "";
 			}
+			return token;
 		}
-		if (token == "\"\"" && (ch = next_char()) != 0) {
-			if (ch == '"')
+	
+		if (ch == ' ' || ch == '\t')
+		{
+			while ((ch = next_char()) != 0) {
+				if (ch != ' ' && ch != '\t') {
+					return_char(ch);
+					break;
+				}
 				token += ch;
-			else
-				return_char(ch);
+			}
 		}
-	}
-	else if (ch == '/')
-	{
-		if ((ch = next_char()) != 0) {
-			if (ch == '/') {
-				token += '*';
-				char last_ch = 0;
-				while ((ch = next_char()) != 0) {
-					if (ch == '\n') {
-						return_char(ch);
-						break;
-					}
-					if (last_ch != '*' || ch != '/') {
+		else if (ch == '"')
+		{
+			while ((ch = next_char()) != 0) {
+				token += ch;
+				if (ch == '"')
+					break;
+				if (ch == '\\') {
+					if ((ch = next_char()) != 0)
 						token += ch;
+				}
+			}
+			if (token == "\"\"" && (ch = next_char()) != 0) {
+				if (ch == '"')
+					token += ch;
+				else
+					return_char(ch);
+			}
+		}
+		else if (ch == '/')
+		{
+			if ((ch = next_char()) != 0) {
+				if (ch == '/') {
+					token += '*';
+					char last_ch = 0;
+					while ((ch = next_char()) != 0) {
+						if (ch == '\n') {
+							return_char(ch);
+							break;
+						}
+						if (last_ch != '*' || ch != '/') {
+							token += ch;
+							last_ch = ch;
+						}
+					}
+					token += " */";
+				}
+				else if (ch == '*') {
+					token += '*';
+					int newline_count = 0;
+					char last_ch = 0;
+					while ((ch = next_char()) != 0) {
+						if (ch == '\n') {
+							newline_count++;
+							token += ' ';
+						} else
+							token += ch;
+						if (last_ch == '*' && ch == '/')
+							break;
 						last_ch = ch;
 					}
+					while (newline_count-- > 0)
+						return_char('\n');
 				}
-				token += " */";
+				else
+					return_char(ch);
 			}
-			else if (ch == '*') {
-				token += '*';
-				int newline_count = 0;
-				char last_ch = 0;
+		}
+		else
+		{
+			const char *ok = "abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ$0123456789";
+			if (ch == '`' || strchr(ok, ch) != NULL)
 				while ((ch = next_char()) != 0) {
-					if (ch == '\n') {
-						newline_count++;
-						token += ' ';
-					} else
-						token += ch;
-					if (last_ch == '*' && ch == '/')
+					if (strchr(ok, ch) == NULL) {
+						return_char(ch);
 						break;
-					last_ch = ch;
+					}
+					token += ch;
 				}
-				while (newline_count-- > 0)
-					return_char('\n');
-			}
-			else
-				return_char(ch);
 		}
+
+		return token;
 	}
-	else
+
+	void input_text(const std::string &text, std::string filename)
 	{
-		const char *ok = "abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ$0123456789";
-		if (ch == '`' || strchr(ok, ch) != NULL)
-			while ((ch = next_char()) != 0) {
-				if (strchr(ok, ch) == NULL) {
-					return_char(ch);
-					break;
-				}
-				token += ch;
-			}
+		insert_input("\n`file_pop\n");
+		insert_input(text);
+		insert_input("`file_push \"" + filename + "\"\n");
 	}
 
-	return token;
-}
-
-static void input_file(std::istream &f, std::string filename)
-{
-	char buffer[513];
-	int rc;
-
-	insert_input("");
-	auto it = input_buffer.begin();
-
-	input_buffer.insert(it, "`file_push \"" + filename + "\"\n");
-	while ((rc = readsome(f, buffer, sizeof(buffer)-1)) > 0) {
-		buffer[rc] = 0;
-		input_buffer.insert(it, buffer);
+	void input_file(std::istream &f, std::string filename)
+	{
+		insert_input("`file_push \"" + filename + "\"\n");
+		input_block.resize(64 * 1024);
+		input_stream = &f;
 	}
-	input_buffer.insert(it, "\n`file_pop\n");
-}
 
-std::string frontend_verilog_preproc(std::istream &f, std::string filename, const std::map<std::string, std::string> pre_defines_map, const std::list<std::string> include_dirs)
-{
-	std::set<std::string> defines_with_args;
-	std::map<std::string, std::string> defines_map(pre_defines_map);
-	int ifdef_fail_level = 0;
-	bool in_elseif = false;
+	// headers are usually included many times (and then skipped by include guards), so each
+	// include file is only read from disk once per preprocessor run
+	const std::string *read_include_file(const std::string &path)
+	{
+		auto it = include_cache.find(path);
+		if (it != include_cache.end())
+			return &it->second;
 
-	output_code.clear();
-	input_buffer.clear();
-	input_buffer_charp = 0;
+		std::ifstream ff(path.c_str());
+		if (ff.fail())
+			return NULL;
 
-	input_file(f, filename);
-	defines_map["YOSYS"] = "1";
-	defines_map["SYNTHESIS"] = "1";
+		verilog_include_files.insert(path);
 
-	while (!input_buffer.empty())
+		std::string &contents = include_cache[path];
+		contents.assign(std::istreambuf_iterator<char>(ff), std::istreambuf_iterator<char>());
+		return &contents;
+	}
+
+	void process_token()
 	{
 		std::string tok = next_token();
 		// printf("token: >>%s<<\n", tok != "\n" ? tok.c_str() : "NEWLINE");
@@ -234,7 +285,7 @@ std::string frontend_verilog_preproc(std::istream &f, std::string filename, cons
 				ifdef_fail_level--;
 			if (ifdef_fail_level == 0)
 				in_elseif = false;
-			continue;
+			return;
 		}
 
 		if (tok == "`else") {
@@ -242,7 +293,7 @@ std::string frontend_verilog_preproc(std::istream &f, std::string filename, cons
 				ifdef_fail_level = 1;
 			else if (ifdef_fail_level == 1 && !in_elseif)
 				ifdef_fail_level = 0;
-			continue;
+			return;
 		}
 
 		if (tok == "`elsif") {
@@ -252,7 +303,7 @@ std::string frontend_verilog_preproc(std::istream &f, std::string filename, cons
 				ifdef_fail_level = 1, in_elseif = true;
 			else if (ifdef_fail_level == 1 && defines_map.count(name) != 0)
 				ifdef_fail_level = 0, in_elseif = true;
-			continue;
+			return;
 		}
 
 		if (tok == "`ifdef") {
@@ -260,7 +311,7 @@ std::string frontend_verilog_preproc(std::istream &f, std::string filename, cons
 			std::string name = next_token(true);
 			if (ifdef_fail_level > 0 || defines_map.count(name) == 0)
 				ifdef_fail_level++;
-			continue;
+			return;
 		}
 
 		if (tok == "`ifndef") {
@@ -268,13 +319,13 @@ std::string frontend_verilog_preproc(std::istream &f, std::string filename, cons
 			std::string name = next_token(true);
 			if (ifdef_fail_level > 0 || defines_map.count(name) != 0)
 				ifdef_fail_level++;
-			continue;
+			return;
 		}
 
 		if (ifdef_fail_level > 0) {
 			if (tok == "\n")
-				output_code.push_back(tok);
-			continue;
+				output_code += tok;
+			return;
 		}
 
 		if (tok == "`include") {
@@ -289,29 +340,28 @@ std::string frontend_verilog_preproc(std::istream &f, std::string filename, cons
 				else
 					fn = fn.substr(0, pos) + fn.substr(pos+1);
 			}
-			std::ifstream ff;
-			ff.clear();
-			ff.open(fn.c_str());
-			if (ff.fail() && fn.size() > 0 && fn[0] != '/' && filename.find('/') != std::string::npos) {
+			std::vector<std::string> paths;
+			paths.push_back(fn);
+			if (fn.size() > 0 && fn[0] != '/' && filename.find('/') != std::string::npos) {
 				// if the include file was not found, it is not given with an absolute path, and the
 				// currently read file is given with a path, then try again relative to its directory
-				ff.clear();
-				ff.open(filename.substr(0, filename.rfind('/')+1) + fn);
+				paths.push_back(filename.substr(0, filename.rfind('/')+1) + fn);
 			}
-			if (ff.fail() && fn.size() > 0 && fn[0] != '/') {
+			if (fn.size() > 0 && fn[0] != '/') {
 				// if the include file was not found and it is not given with an absolute path, then
 				// search it in the include path
-				for (auto incdir : include_dirs) {
-					ff.clear();
-					ff.open(incdir + '/' + fn);
-					if (!ff.fail()) break;
-				}
+				for (auto incdir : include_dirs)
+					paths.push_back(incdir + '/' + fn);
 			}
-			if (ff.fail())
-				output_code.push_back("`file_notfound " + fn);
+			const std::string *contents = NULL;
+			for (auto &path : paths)
+				if ((contents = read_include_file(path)) != NULL)
+					break;
+			if (contents == NULL)
+				output_code += "`file_notfound " + fn;
 			else
-				input_file(ff, fn);
-			continue;
+				input_text(*contents, fn);
+			return;
 		}
 
 		if (tok == "`define") {
@@ -378,7 +428,7 @@ std::string frontend_verilog_preproc(std::istream &f, std::string filename, cons
 				defines_with_args.insert(name);
 			else
 				defines_with_args.erase(name);
-			continue;
+			return;
 		}
 
 		if (tok == "`undef") {
@@ -388,7 +438,7 @@ std::string frontend_verilog_preproc(std::istream &f, std::string filename, cons
 			// printf("undef: >>%s<<\n", name.c_str());
 			defines_map.erase(name);
 			defines_with_args.erase(name);
-			continue;
+			return;
 		}
 
 		if (tok == "`timescale") {
@@ -397,7 +447,7 @@ std::string frontend_verilog_preproc(std::istream &f, std::string filename, cons
 				tok = next_token(true);
 			if (tok == "\n")
 				return_char('\n');
-			continue;
+			return;
 		}
 
 		if (tok.size() > 1 && tok[0] == '`' && defines_map.count(tok.substr(1)) > 0) {
@@ -430,22 +480,52 @@ std::string frontend_verilog_preproc(std::istream &f, std::string filename, cons
 				insert_input(skipped_spaces);
 			}
 			insert_input(defines_map[name]);
-			continue;
+			return;
 		}
 
-		output_code.push_back(tok);
+		output_code += tok;
 	}
 
-	std::string output;
-	for (auto &str : output_code)
-		output += str;
+	// process input until at least one output block is available or the input is exhausted
+	virtual int underflow()
+	{
+		if (gptr() < egptr())
+			return traits_type::to_int_type(*gptr());
+
+		while (GetSize(output_code) < 64 * 1024 && !input_empty())
+			process_token();
+
+		output_buffer.clear();
+		output_buffer.swap(output_code);
+
+		if (output_buffer.empty())
+			return traits_type::eof();
 
-	output_code.clear();
-	input_buffer.clear();
-	input_buffer_charp = 0;
+		setg(&output_buffer[0], &output_buffer[0], &output_buffer[0] + output_buffer.size());
+		return traits_type::to_int_type(*gptr());
+	}
+};
+
+struct VerilogPreprocStream : private VerilogPreproc, public std::istream
+{
+	VerilogPreprocStream(std::istream &f, std::string filename, const std::map<std::string, std::string> &pre_defines_map,
+			const std::list<std::string> &include_dirs) : VerilogPreproc(f, filename, pre_defines_map, include_dirs),
+			std::istream(static_cast<VerilogPreproc*>(this)) { }
+};
 
-	return output;
+std::string frontend_verilog_preproc(std::istream &f, std::string filename, const std::map<std::string, std::string> pre_defines_map, const std::list<std::string> include_dirs)
+{
+	VerilogPreproc preproc(f, filename, pre_defines_map, include_dirs);
+
+	while (!preproc.input_empty())
+		preproc.process_token();
+
+	return preproc.output_code;
 }
 
-YOSYS_NAMESPACE_END
+std::istream *frontend_verilog_preproc_stream(std::istream &f, std::string filename, const std::map<std::string, std::string> pre_defines_map, const std::list<std::string> include_dirs)
+{
+	return new VerilogPreprocStream(f, filename, pre_defines_map, include_dirs);
+}
 
+YOSYS_NAMESPACE_END
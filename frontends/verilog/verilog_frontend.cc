@@ -36,7 +36,7 @@ using namespace VERILOG_FRONTEND;
 
 // use the Verilog bison/flex parser to generate an AST and use AST::process() to convert it to RTLIL
 
-static std::vector<std::string> verilog_defaults;
+std::vector<std::string> verilog_defaults;
 static std::list<std::vector<std::string>> verilog_defaults_stack;
 
 struct VerilogFrontend : public Frontend {
@@ -291,13 +291,14 @@ struct VerilogFrontend : public Frontend {
 		default_nettype_wire = true;
 
 		lexin = f;
-		std::string code_after_preproc;
 
 		if (!flag_nopp) {
-			code_after_preproc = frontend_verilog_preproc(*f, filename, defines_map, include_dirs);
-			if (flag_ppdump)
+			if (flag_ppdump) {
+				std::string code_after_preproc = frontend_verilog_preproc(*f, filename, defines_map, include_dirs);
 				log("-- Verilog code after preprocessor --\n%s-- END OF DUMP --\n", code_after_preproc.c_str());
-			lexin = new std::istringstream(code_after_preproc);
+				lexin = new std::istringstream(code_after_preproc);
+			} else
+				lexin = frontend_verilog_preproc_stream(*f, filename, defines_map, include_dirs);
 		}
 
 		frontend_verilog_yyset_lineno(1);
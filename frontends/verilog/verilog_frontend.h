@@ -58,8 +58,15 @@ namespace VERILOG_FRONTEND
 	extern std::istream *lexin;
 }
 
-// the pre-processor
+// the pre-processor (the stream version produces its output incrementally while it is read)
 std::string frontend_verilog_preproc(std::istream &f, std::string filename, const std::map<std::string, std::string> pre_defines_map, const std::list<std::string> include_dirs);
+std::istream *frontend_verilog_preproc_stream(std::istream &f, std::string filename, const std::map<std::string, std::string> pre_defines_map, const std::list<std::string> include_dirs);
+
+// names of the files read by `include since this set was last cleared (used by techmap to validate its map file cache)
+extern std::set<std::string> verilog_include_files;
+
+// the options set with verilog_defaults, they are added to the options of each read_verilog call
+extern std::vector<std::string> verilog_defaults;
 
 YOSYS_NAMESPACE_END
 
@@ -82,10 +82,10 @@ template<> struct hash_ops<std::string> {
 };
 
 template<typename P, typename Q> struct hash_ops<std::pair<P, Q>> {
-	static inline bool cmp(std::pair<P, Q> a, std::pair<P, Q> b) {
+	static inline bool cmp(const std::pair<P, Q> &a, const std::pair<P, Q> &b) {
 		return a == b;
 	}
-	static inline unsigned int hash(std::pair<P, Q> a) {
+	static inline unsigned int hash(const std::pair<P, Q> &a) {
 		hash_ops<P> p_ops;
 		hash_ops<Q> q_ops;
 		return mkhash(p_ops.hash(a.first), q_ops.hash(a.second));
@@ -93,28 +93,28 @@ template<typename P, typename Q> struct hash_ops<std::pair<P, Q>> {
 };
 
 template<typename... T> struct hash_ops<std::tuple<T...>> {
-	static inline bool cmp(std::tuple<T...> a, std::tuple<T...> b) {
+	static inline bool cmp(const std::tuple<T...> &a, const std::tuple<T...> &b) {
 		return a == b;
 	}
 	template<size_t I = 0>
-	static inline typename std::enable_if<I == sizeof...(T), unsigned int>::type hash(std::tuple<T...>) {
+	static inline typename std::enable_if<I == sizeof...(T), unsigned int>::type hash(const std::tuple<T...> &) {
 		return mkhash_init;
 	}
 	template<size_t I = 0>
-	static inline typename std::enable_if<I != sizeof...(T), unsigned int>::type hash(std::tuple<T...> a) {
+	static inline typename std::enable_if<I != sizeof...(T), unsigned int>::type hash(const std::tuple<T...> &a) {
 		hash_ops<typename std::tuple_element<I, std::tuple<T...>>::type> element_ops;
 		return mkhash(hash<I+1>(a), element_ops.hash(std::get<I>(a)));
 	}
 };
 
 template<typename T> struct hash_ops<std::vector<T>> {
-	static inline bool cmp(std::vector<T> a, std::vector<T> b) {
+	static inline bool cmp(const std::vector<T> &a, const std::vector<T> &b) {
 		return a == b;
 	}
-	static inline unsigned int hash(std::vector<T> a) {
+	static inline unsigned int hash(const std::vector<T> &a) {
 		hash_ops<T> t_ops;
 		unsigned int h = mkhash_init;
-		for (auto k : a)
+		for (auto &k : a)
 			h = mkhash(h, t_ops.hash(k));
 		return h;
 	}
@@ -533,6 +533,9 @@ public:
 	bool empty() const { return entries.empty(); }
 	void clear() { hashtable.clear(); entries.clear(); }
 
+	size_t capacity() const { return entries.capacity(); }
+	void reserve(size_t n) { entries.reserve(n); }
+
 	iterator begin() { return iterator(this, int(entries.size())-1); }
 	iterator end() { return iterator(nullptr, -1); }
 
@@ -499,6 +499,7 @@ RTLIL::Module::Module()
 	design = nullptr;
 	refcount_wires_ = 0;
 	refcount_cells_ = 0;
+	modcount_ = 0;
 }
 
 RTLIL::Module::~Module()
@@ -1121,6 +1122,8 @@ void RTLIL::Module::cloneInto(RTLIL::Module *new_mod) const
 	for (auto &conn : connections_)
 		new_mod->connect(conn);
 
+	new_mod->avail_parameters = avail_parameters;
+
 	for (auto &attr : attributes)
 		new_mod->attributes[attr.first] = attr.second;
 
@@ -1214,6 +1217,7 @@ void RTLIL::Module::add(RTLIL::Wire *wire)
 	log_assert(refcount_wires_ == 0);
 	wires_[wire->name] = wire;
 	wire->module = this;
+	modcount_++;
 }
 
 void RTLIL::Module::add(RTLIL::Cell *cell)
@@ -1223,6 +1227,7 @@ void RTLIL::Module::add(RTLIL::Cell *cell)
 	log_assert(refcount_cells_ == 0);
 	cells_[cell->name] = cell;
 	cell->module = this;
+	modcount_++;
 }
 
 namespace {
@@ -1257,6 +1262,9 @@ void RTLIL::Module::remove(const pool<RTLIL::Wire*> &wires)
 		wires_.erase(it->name);
 		delete it;
 	}
+
+	if (!wires.empty())
+		modcount_++;
 }
 
 void RTLIL::Module::remove(RTLIL::Cell *cell)
@@ -1268,6 +1276,7 @@ void RTLIL::Module::remove(RTLIL::Cell *cell)
 	log_assert(refcount_cells_ == 0);
 	cells_.erase(cell->name);
 	delete cell;
+	modcount_++;
 }
 
 void RTLIL::Module::rename(RTLIL::Wire *wire, RTLIL::IdString new_name)
@@ -1312,6 +1321,7 @@ void RTLIL::Module::swap_names(RTLIL::Wire *w1, RTLIL::Wire *w2)
 
 	wires_[w1->name] = w1;
 	wires_[w2->name] = w2;
+	modcount_++;
 }
 
 void RTLIL::Module::swap_names(RTLIL::Cell *c1, RTLIL::Cell *c2)
@@ -1327,6 +1337,7 @@ void RTLIL::Module::swap_names(RTLIL::Cell *c1, RTLIL::Cell *c2)
 
 	cells_[c1->name] = c1;
 	cells_[c2->name] = c2;
+	modcount_++;
 }
 
 RTLIL::IdString RTLIL::Module::uniquify(RTLIL::IdString name)
@@ -1378,6 +1389,7 @@ void RTLIL::Module::connect(const RTLIL::SigSig &conn)
 	}
 
 	connections_.push_back(conn);
+	modcount_++;
 }
 
 void RTLIL::Module::connect(const RTLIL::SigSpec &lhs, const RTLIL::SigSpec &rhs)
@@ -1402,6 +1414,7 @@ void RTLIL::Module::new_connections(const std::vector<RTLIL::SigSig> &new_conn)
 	}
 
 	connections_ = new_conn;
+	modcount_++;
 }
 
 const std::vector<RTLIL::SigSig> &RTLIL::Module::connections() const
@@ -1426,6 +1439,22 @@ void RTLIL::Module::fixup_ports()
 		ports.push_back(all_ports[i]->name);
 		all_ports[i]->port_id = i+1;
 	}
+
+	modcount_++;
+}
+
+void RTLIL::Module::set_modcount_stamp(const std::string &key, unsigned int modcount)
+{
+	if (modcount == modcount_)
+		modcount_stamps_[key] = modcount;
+	else
+		modcount_stamps_.erase(key);
+}
+
+bool RTLIL::Module::check_modcount_stamp(const std::string &key) const
+{
+	auto it = modcount_stamps_.find(key);
+	return it != modcount_stamps_.end() && it->second == modcount_;
 }
 
 RTLIL::Wire *RTLIL::Module::addWire(RTLIL::IdString name, int width)
@@ -1468,6 +1497,47 @@ RTLIL::Cell *RTLIL::Module::addCell(RTLIL::IdString name, const RTLIL::Cell *oth
 	return cell;
 }
 
+std::vector<RTLIL::Cell*> RTLIL::Module::addGates(RTLIL::IdString type, int count, const std::vector<std::pair<RTLIL::IdString, RTLIL::SigSpec>> &ports, const std::string &name_prefix)
+{
+	std::vector<RTLIL::Cell*> gates;
+	if (count <= 0)
+		return gates;
+
+	std::vector<std::vector<RTLIL::SigBit>> port_bits;
+	for (auto &it : ports) {
+		log_assert(GetSize(it.second) == count || GetSize(it.second) == 1);
+		port_bits.push_back(it.second.to_sigbit_vector());
+	}
+
+	// monitors and xtrace want to see every single connection
+	bool use_set_port = !monitors.empty() || (design && !design->monitors.empty()) || yosys_xtrace;
+
+	size_t needed_cells = cells_.size() + count;
+	if (needed_cells > cells_.capacity())
+		cells_.reserve(std::max(needed_cells, 2 * cells_.capacity()));
+	gates.reserve(count);
+
+	for (int i = 0; i < count; i++)
+	{
+		RTLIL::Cell *cell = addCell(name_prefix + stringf("%d", autoidx++), type);
+		cell->connections_.reserve(ports.size());
+
+		for (int k = 0; k < GetSize(ports); k++) {
+			const std::vector<RTLIL::SigBit> &bits = port_bits[k];
+			const RTLIL::SigBit &bit = GetSize(bits) == 1 ? bits[0] : bits[i];
+			if (use_set_port)
+				cell->setPort(ports[k].first, bit);
+			else
+				cell->connections_[ports[k].first] = bit;
+		}
+
+		gates.push_back(cell);
+	}
+
+	modcount_++;
+	return gates;
+}
+
 #define DEF_METHOD(_func, _y_size, _type) \
 	RTLIL::Cell* RTLIL::Module::add ## _func(RTLIL::IdString name, RTLIL::SigSpec sig_a, RTLIL::SigSpec sig_y, bool is_signed) { \
 		RTLIL::Cell *cell = addCell(name, _type);           \
@@ -1911,6 +1981,7 @@ void RTLIL::Cell::unsetPort(RTLIL::IdString portname)
 		}
 
 		connections_.erase(conn_it);
+		module->modcount_++;
 	}
 }
 
@@ -1939,6 +2010,7 @@ void RTLIL::Cell::setPort(RTLIL::IdString portname, RTLIL::SigSpec signal)
 	}
 
 	conn_it->second = signal;
+	module->modcount_++;
 }
 
 const RTLIL::SigSpec &RTLIL::Cell::getPort(RTLIL::IdString portname) const
@@ -1992,11 +2064,15 @@ bool RTLIL::Cell::hasParam(RTLIL::IdString paramname) const
 void RTLIL::Cell::unsetParam(RTLIL::IdString paramname)
 {
 	parameters.erase(paramname);
+	if (module)
+		module->modcount_++;
 }
 
 void RTLIL::Cell::setParam(RTLIL::IdString paramname, RTLIL::Const value)
 {
 	parameters[paramname] = value;
+	if (module)
+		module->modcount_++;
 }
 
 const RTLIL::Const &RTLIL::Cell::getParam(RTLIL::IdString paramname) const
@@ -876,6 +876,20 @@ public:
 	int refcount_wires_;
 	int refcount_cells_;
 
+	// Incremented by the Module and Cell API on every structural change: adding, removing and
+	// renaming wires and cells, fixup_ports(), connect() and new_connections(), setPort() and
+	// unsetPort(), setParam() and unsetParam(), and addGates().
+	//
+	// The counter is NOT incremented for direct writes to data members, i.e. changes of
+	// Cell::type, Cell::parameters, Cell::connections_, any 'attributes' dict, Wire::width,
+	// Wire::port_input/port_output/port_id, or Module::connections_. Code that modifies a module
+	// this way must increment modcount_ itself. Changes in other modules (e.g. port directions
+	// of a submodule) are never reflected in this counter. Stamps (see set_modcount_stamp())
+	// must therefore only be trusted within a scope where all modifications are known to use
+	// the API above, such as the opt_* passes within one 'opt' run.
+	unsigned int modcount_;
+	dict<std::string, unsigned int> modcount_stamps_;
+
 	dict<RTLIL::IdString, RTLIL::Wire*> wires_;
 	dict<RTLIL::IdString, RTLIL::Cell*> cells_;
 	std::vector<RTLIL::SigSig> connections_;
@@ -920,6 +934,10 @@ public:
 		return design->selected_member(name, member->name);
 	}
 
+	// Remember (and later check) that the module was in its current state when a pass found nothing to do.
+	void set_modcount_stamp(const std::string &key, unsigned int modcount);
+	bool check_modcount_stamp(const std::string &key) const;
+
 	RTLIL::Wire* wire(RTLIL::IdString id) { return wires_.count(id) ? wires_.at(id) : nullptr; }
 	RTLIL::Cell* cell(RTLIL::IdString id) { return cells_.count(id) ? cells_.at(id) : nullptr; }
 
@@ -1023,6 +1041,10 @@ public:
 	RTLIL::Cell* addAoi4Gate (RTLIL::IdString name, RTLIL::SigBit sig_a, RTLIL::SigBit sig_b, RTLIL::SigBit sig_c, RTLIL::SigBit sig_d, RTLIL::SigBit sig_y);
 	RTLIL::Cell* addOai4Gate (RTLIL::IdString name, RTLIL::SigBit sig_a, RTLIL::SigBit sig_b, RTLIL::SigBit sig_c, RTLIL::SigBit sig_d, RTLIL::SigBit sig_y);
 
+	// Creates 'count' single-bit cells of the same type at once, named name_prefix (usually NEW_ID_PREFIX) plus autoidx.
+	// Gate i has each port connected to bit i of the given signal, or to the signal itself if it is a single shared bit.
+	std::vector<RTLIL::Cell*> addGates(RTLIL::IdString type, int count, const std::vector<std::pair<RTLIL::IdString, RTLIL::SigSpec>> &ports, const std::string &name_prefix);
+
 	RTLIL::Cell* addDffGate    (RTLIL::IdString name, RTLIL::SigSpec sig_clk, RTLIL::SigSpec sig_d, RTLIL::SigSpec sig_q, bool clk_polarity = true);
 	RTLIL::Cell* addDffeGate   (RTLIL::IdString name, RTLIL::SigSpec sig_clk, RTLIL::SigSpec sig_en, RTLIL::SigSpec sig_d, RTLIL::SigSpec sig_q, bool clk_polarity = true, bool en_polarity = true);
 	RTLIL::Cell* addDffsrGate  (RTLIL::IdString name, RTLIL::SigSpec sig_clk, RTLIL::SigSpec sig_set, RTLIL::SigSpec sig_clr,
@@ -0,0 +1 @@
+namespace Yosys { extern const char *yosys_version_str; const char *yosys_version_str="Yosys 0.5+0 (git sha1 5fdf43a, gcc 12.2.0-14+deb12u1 -fPIC -Os)"; }
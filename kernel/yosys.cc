@@ -473,7 +473,7 @@ void yosys_shutdown()
 	IdString::put_reference(empty_id.index_);
 }
 
-RTLIL::IdString new_id(std::string file, int line, std::string func)
+std::string new_id_prefix(std::string file, int line, std::string func)
 {
 #ifdef _WIN32
 	size_t pos = file.find_last_of("/\\");
@@ -487,7 +487,12 @@ RTLIL::IdString new_id(std::string file, int line, std::string func)
 	if (pos != std::string::npos)
 		func = func.substr(pos+1);
 
-	return stringf("$auto$%s:%d:%s$%d", file.c_str(), line, func.c_str(), autoidx++);
+	return stringf("$auto$%s:%d:%s$", file.c_str(), line, func.c_str());
+}
+
+RTLIL::IdString new_id(std::string file, int line, std::string func)
+{
+	return new_id_prefix(file, line, func) + stringf("%d", autoidx++);
 }
 
 RTLIL::Design *yosys_get_design()
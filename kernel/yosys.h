@@ -243,10 +243,15 @@ Tcl_Interp *yosys_get_tcl_interp();
 extern RTLIL::Design *yosys_design;
 
 RTLIL::IdString new_id(std::string file, int line, std::string func);
+std::string new_id_prefix(std::string file, int line, std::string func);
 
 #define NEW_ID \
 	YOSYS_NAMESPACE_PREFIX new_id(__FILE__, __LINE__, __FUNCTION__)
 
+// name prefix for Module::addGates(), which appends autoidx itself
+#define NEW_ID_PREFIX \
+	YOSYS_NAMESPACE_PREFIX new_id_prefix(__FILE__, __LINE__, __FUNCTION__)
+
 #define ID(_str) \
 	([]() { static YOSYS_NAMESPACE_PREFIX RTLIL::IdString _id(_str); return _id; })()
 
@@ -295,8 +295,21 @@ class SubCircuit::SolverWorker
 		Graph graph;
 		adjMatrix_t adjMatrix;
 		std::vector<bool> usedNodes;
+
+		// node signatures: for each node the number of adjacent nodes per typeId
+		std::vector<std::map<std::string, int>> neighbourTypes;
+		std::map<std::string, std::set<int>> nodesByTypeId;
 	};
 
+	static void generateNodeSignatures(const GraphData &gd, std::vector<std::map<std::string, int>> &neighbourTypes)
+	{
+		neighbourTypes.clear();
+		neighbourTypes.resize(gd.graph.nodes.size());
+		for (int i = 0; i < int(gd.graph.nodes.size()); i++)
+			for (const auto &it : gd.adjMatrix[i])
+				neighbourTypes[i][gd.graph.nodes[it.first].typeId]++;
+	}
+
 	static void printAdjMatrix(const adjMatrix_t &matrix)
 	{
 		my_printf("%7s", "");
@@ -848,11 +861,43 @@ class SubCircuit::SolverWorker
 		return false;
 	}
 
+	bool matchNodeSignatures(const std::map<std::string, int> &needleNeighbourTypes, const GraphData &needle, int needleNodeIdx, const GraphData &haystack, int haystackNodeIdx) const
+	{
+		// the needle neighbours must be mapped to distinct haystack neighbours of the same or a compatible type,
+		// so a haystack node with fewer (suitable) neighbours can never be part of a solution
+
+		const std::map<std::string, int> &haystackNeighbourTypes = haystack.neighbourTypes[haystackNodeIdx];
+
+		if (haystack.adjMatrix[haystackNodeIdx].size() < needle.adjMatrix[needleNodeIdx].size())
+			return false;
+
+		for (const auto &it : needleNeighbourTypes)
+		{
+			int count = 0;
+			auto hit = haystackNeighbourTypes.find(it.first);
+			if (hit != haystackNeighbourTypes.end())
+				count += hit->second;
+
+			if (count < it.second && compatibleTypes.count(it.first) > 0)
+				for (const std::string &compatibleTypeId : compatibleTypes.at(it.first)) {
+					hit = haystackNeighbourTypes.find(compatibleTypeId);
+					if (hit != haystackNeighbourTypes.end())
+						count += hit->second;
+				}
+
+			if (count < it.second)
+				return false;
+		}
+
+		return true;
+	}
+
 	void generateEnumerationMatrix(std::vector<std::set<int>> &enumerationMatrix, const GraphData &needle, const GraphData &haystack, const std::map<std::string, std::set<std::string>> &initialMappings) const
 	{
-		std::map<std::string, std::set<int>> haystackNodesByTypeId;
-		for (int i = 0; i < int(haystack.graph.nodes.size()); i++)
-			haystackNodesByTypeId[haystack.graph.nodes[i].typeId].insert(i);
+		static const std::set<int> noNodes;
+
+		std::vector<std::map<std::string, int>> needleNeighbourTypes;
+		generateNodeSignatures(needle, needleNeighbourTypes);
 
 		enumerationMatrix.clear();
 		enumerationMatrix.resize(needle.graph.nodes.size());
@@ -860,25 +905,27 @@ class SubCircuit::SolverWorker
 		{
 			const Graph::Node &nn = needle.graph.nodes[i];
 
-			for (int j : haystackNodesByTypeId[nn.typeId]) {
-				const Graph::Node &hn = haystack.graph.nodes[j];
-				if (initialMappings.count(nn.nodeId) > 0 && initialMappings.at(nn.nodeId).count(hn.nodeId) == 0)
-					continue;
-				if (!matchNodes(needle, i, haystack, j))
-					continue;
-				enumerationMatrix[i].insert(j);
-			}
+			std::vector<const std::set<int>*> haystackNodeSets;
+			auto it = haystack.nodesByTypeId.find(nn.typeId);
+			haystackNodeSets.push_back(it != haystack.nodesByTypeId.end() ? &it->second : &noNodes);
 
 			if (compatibleTypes.count(nn.typeId) > 0)
-				for (const std::string &compatibleTypeId : compatibleTypes.at(nn.typeId))
-					for (int j : haystackNodesByTypeId[compatibleTypeId]) {
-						const Graph::Node &hn = haystack.graph.nodes[j];
-						if (initialMappings.count(nn.nodeId) > 0 && initialMappings.at(nn.nodeId).count(hn.nodeId) == 0)
-							continue;
-						if (!matchNodes(needle, i, haystack, j))
-							continue;
-						enumerationMatrix[i].insert(j);
-					}
+				for (const std::string &compatibleTypeId : compatibleTypes.at(nn.typeId)) {
+					it = haystack.nodesByTypeId.find(compatibleTypeId);
+					haystackNodeSets.push_back(it != haystack.nodesByTypeId.end() ? &it->second : &noNodes);
+				}
+
+			for (auto haystackNodes : haystackNodeSets)
+				for (int j : *haystackNodes) {
+					const Graph::Node &hn = haystack.graph.nodes[j];
+					if (initialMappings.count(nn.nodeId) > 0 && initialMappings.at(nn.nodeId).count(hn.nodeId) == 0)
+						continue;
+					if (!matchNodeSignatures(needleNeighbourTypes[i], needle, i, haystack, j))
+						continue;
+					if (!matchNodes(needle, i, haystack, j))
+						continue;
+					enumerationMatrix[i].insert(j);
+				}
 		}
 	}
 
@@ -1488,6 +1535,10 @@ protected:
 		gd.graphId = graphId;
 		gd.graph = graph;
 		diCache.add(gd.graph, gd.adjMatrix, graphId, userSolver);
+
+		generateNodeSignatures(gd, gd.neighbourTypes);
+		for (int i = 0; i < int(gd.graph.nodes.size()); i++)
+			gd.nodesByTypeId[gd.graph.nodes[i].typeId].insert(i);
 	}
 
 	void addCompatibleTypes(std::string needleTypeId, std::string haystackTypeId)
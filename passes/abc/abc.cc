@@ -25,9 +25,9 @@
 // University of California. Berkeley. July 28, 1992
 // http://www.ece.cmu.edu/~ee760/760docs/blif.pdf
 
-// [[CITE]] Kahn's Topological sorting algorithm
-// Kahn, Arthur B. (1962), "Topological sorting of large networks", Communications of the ACM 5 (11): 558–562, doi:10.1145/368996.369025
-// http://en.wikipedia.org/wiki/Topological_sorting
+// [[CITE]] Tarjan's strongly connected components algorithm
+// Tarjan, R. E. (1972), "Depth-first search and linear graph algorithms", SIAM Journal on Computing 1 (2): 146–160, doi:10.1137/0201010
+// http://en.wikipedia.org/wiki/Tarjan's_strongly_connected_components_algorithm
 
 #define ABC_COMMAND_LIB "strash; scorr; ifraig; retime {D}; strash; dch -f; map {D}"
 #define ABC_COMMAND_CTR "strash; scorr; ifraig; retime {D}; strash; dch -f; map {D}; buffer; upsize {D}; dnsize {D}; stime -p"
@@ -313,166 +313,212 @@ std::string remap_name(RTLIL::IdString abc_name)
 	return sstr.str();
 }
 
-void dump_loop_graph(FILE *f, int &nr, std::map<int, std::set<int>> &edges, std::set<int> &workpool, std::vector<int> &in_counts)
+void handle_loops()
 {
-	if (f == NULL)
-		return;
+	// http://en.wikipedia.org/wiki/Tarjan's_strongly_connected_components_algorithm
+	// (Tarjan, R. E. (1972), "Depth-first search and linear graph algorithms")
 
-	log("Dumping loop state graph to slide %d.\n", ++nr);
+	int num_nodes = GetSize(signal_list);
 
-	fprintf(f, "digraph \"slide%d\" {\n", nr);
-	fprintf(f, "  label=\"slide%d\";\n", nr);
-	fprintf(f, "  rankdir=\"TD\";\n");
+	// flat adjacency arrays for driver->consumer (fanout) and consumer->driver (fanin) edges
 
-	std::set<int> nodes;
-	for (auto &e : edges) {
-		nodes.insert(e.first);
-		for (auto n : e.second)
-			nodes.insert(n);
-	}
+	std::vector<int> fanout_begin(num_nodes+1), fanout_data;
+	std::vector<int> fanin_begin(num_nodes+1), fanin_data;
 
-	for (auto n : nodes)
-		fprintf(f, "  n%d [label=\"%s\\nid=%d, count=%d\"%s];\n", n, log_signal(signal_list[n].bit),
-				n, in_counts[n], workpool.count(n) ? ", shape=box" : "");
+	for (auto &g : signal_list) {
+		fanin_begin[g.id] = GetSize(fanin_data);
+		if (g.type == G(NONE) || g.type == G(FF))
+			continue;
+		if (g.in1 >= 0)
+			fanin_data.push_back(g.in1);
+		if (g.in2 >= 0 && g.in2 != g.in1)
+			fanin_data.push_back(g.in2);
+		if (g.in3 >= 0 && g.in3 != g.in2 && g.in3 != g.in1)
+			fanin_data.push_back(g.in3);
+		if (g.in4 >= 0 && g.in4 != g.in3 && g.in4 != g.in2 && g.in4 != g.in1)
+			fanin_data.push_back(g.in4);
+	}
+	fanin_begin[num_nodes] = GetSize(fanin_data);
 
-	for (auto &e : edges)
-	for (auto n : e.second)
-		fprintf(f, "  n%d -> n%d;\n", e.first, n);
+	for (int id : fanin_data)
+		fanout_begin[id+1]++;
+	for (int i = 0; i < num_nodes; i++)
+		fanout_begin[i+1] += fanout_begin[i];
 
-	fprintf(f, "}\n");
-}
+	fanout_data.resize(GetSize(fanin_data));
+	std::vector<int> fanout_fill(fanout_begin.begin(), fanout_begin.end()-1);
+	for (int id2 = 0; id2 < num_nodes; id2++)
+		for (int k = fanin_begin[id2]; k < fanin_begin[id2+1]; k++)
+			fanout_data[fanout_fill[fanin_data[k]]++] = id2;
 
-void handle_loops()
-{
-	// http://en.wikipedia.org/wiki/Topological_sorting
-	// (Kahn, Arthur B. (1962), "Topological sorting of large networks")
+	// find all strongly connected components (iterative Tarjan)
 
-	std::map<int, std::set<int>> edges;
-	std::vector<int> in_edges_count(signal_list.size());
-	std::set<int> workpool;
+	std::vector<int> node_index(num_nodes, -1), node_lowlink(num_nodes), node_scc(num_nodes, -1);
+	std::vector<bool> node_on_stack(num_nodes);
+	std::vector<int> tarjan_stack;
+	std::vector<std::pair<int, int>> call_stack;
+	std::vector<std::vector<int>> loops;
+	int index_counter = 0, scc_counter = 0;
 
-	FILE *dot_f = NULL;
-	int dot_nr = 0;
+	for (int root = 0; root < num_nodes; root++)
+	{
+		if (node_index[root] >= 0)
+			continue;
 
-	// uncomment for troubleshooting the loop detection code
-	// dot_f = fopen("test.dot", "w");
+		call_stack.push_back(std::pair<int, int>(root, fanout_begin[root]));
+		node_index[root] = node_lowlink[root] = index_counter++;
+		node_on_stack[root] = true;
+		tarjan_stack.push_back(root);
 
-	for (auto &g : signal_list) {
-		if (g.type == G(NONE) || g.type == G(FF)) {
-			workpool.insert(g.id);
-		} else {
-			if (g.in1 >= 0) {
-				edges[g.in1].insert(g.id);
-				in_edges_count[g.id]++;
-			}
-			if (g.in2 >= 0 && g.in2 != g.in1) {
-				edges[g.in2].insert(g.id);
-				in_edges_count[g.id]++;
+		while (!call_stack.empty())
+		{
+			int id = call_stack.back().first;
+			int &k = call_stack.back().second;
+
+			if (k < fanout_begin[id+1]) {
+				int id2 = fanout_data[k++];
+				if (node_index[id2] < 0) {
+					call_stack.push_back(std::pair<int, int>(id2, fanout_begin[id2]));
+					node_index[id2] = node_lowlink[id2] = index_counter++;
+					node_on_stack[id2] = true;
+					tarjan_stack.push_back(id2);
+				} else if (node_on_stack[id2])
+					node_lowlink[id] = std::min(node_lowlink[id], node_index[id2]);
+				continue;
 			}
-			if (g.in3 >= 0 && g.in3 != g.in2 && g.in3 != g.in1) {
-				edges[g.in3].insert(g.id);
-				in_edges_count[g.id]++;
+
+			call_stack.pop_back();
+			if (!call_stack.empty()) {
+				int parent = call_stack.back().first;
+				node_lowlink[parent] = std::min(node_lowlink[parent], node_lowlink[id]);
 			}
-			if (g.in4 >= 0 && g.in4 != g.in3 && g.in4 != g.in2 && g.in4 != g.in1) {
-				edges[g.in4].insert(g.id);
-				in_edges_count[g.id]++;
+
+			if (node_lowlink[id] != node_index[id])
+				continue;
+
+			std::vector<int> scc;
+			while (1) {
+				int id2 = tarjan_stack.back();
+				tarjan_stack.pop_back();
+				node_on_stack[id2] = false;
+				node_scc[id2] = scc_counter;
+				scc.push_back(id2);
+				if (id2 == id)
+					break;
 			}
+
+			bool is_loop = GetSize(scc) > 1;
+			for (int k2 = fanout_begin[id]; !is_loop && k2 < fanout_begin[id+1]; k2++)
+				if (fanout_data[k2] == id)
+					is_loop = true;
+
+			if (is_loop)
+				loops.push_back(scc);
+			scc_counter++;
 		}
 	}
 
-	dump_loop_graph(dot_f, dot_nr, edges, workpool, in_edges_count);
+	// select the feedback edges: for each loop perform a DFS over the fanin edges, starting with
+	// the nodes we like best as loop breakers. every back edge of this DFS points to a driver on the
+	// DFS stack and breaking all of them leaves the SCC acyclic.
 
-	while (workpool.size() > 0)
-	{
-		int id = *workpool.begin();
-		workpool.erase(id);
+	std::vector<int> breaker_nodes;
+	std::map<int, std::vector<int>> breaker_edges;
+	std::vector<int> dfs_state(num_nodes);
 
-		// log("Removing non-loop node %d from graph: %s\n", id, log_signal(signal_list[id].bit));
+	for (auto &scc : loops)
+	{
+		int this_scc = node_scc[scc.front()];
+
+		std::sort(scc.begin(), scc.end(), [&](int id1, int id2) {
+			RTLIL::Wire *w1 = signal_list[id1].bit.wire;
+			RTLIL::Wire *w2 = signal_list[id2].bit.wire;
+			if (w1 == NULL || w2 == NULL)
+				return w1 != w2 ? w2 == NULL : id1 < id2;
+			if (w1->name[0] != w2->name[0])
+				return w1->name[0] == '\\';
+			int fanout1 = fanout_begin[id1+1] - fanout_begin[id1];
+			int fanout2 = fanout_begin[id2+1] - fanout_begin[id2];
+			if (fanout1 != fanout2)
+				return fanout1 > fanout2;
+			if (w1->name != w2->name)
+				return w1->name.str() < w2->name.str();
+			return id1 < id2;
+		});
+
+		for (int root : scc)
+		{
+			if (dfs_state[root] != 0)
+				continue;
 
-		for (int id2 : edges[id]) {
-			log_assert(in_edges_count[id2] > 0);
-			if (--in_edges_count[id2] == 0)
-				workpool.insert(id2);
-		}
-		edges.erase(id);
+			call_stack.push_back(std::pair<int, int>(root, fanin_begin[root]));
+			dfs_state[root] = 1;
 
-		dump_loop_graph(dot_f, dot_nr, edges, workpool, in_edges_count);
+			while (!call_stack.empty())
+			{
+				int id = call_stack.back().first;
+				int &k = call_stack.back().second;
 
-		while (workpool.size() == 0)
-		{
-			if (edges.size() == 0)
-				break;
-
-			int id1 = edges.begin()->first;
-
-			for (auto &edge_it : edges) {
-				int id2 = edge_it.first;
-				RTLIL::Wire *w1 = signal_list[id1].bit.wire;
-				RTLIL::Wire *w2 = signal_list[id2].bit.wire;
-				if (w1 == NULL)
-					id1 = id2;
-				else if (w2 == NULL)
+				if (k == fanin_begin[id+1]) {
+					dfs_state[id] = 2;
+					call_stack.pop_back();
 					continue;
-				else if (w1->name[0] == '$' && w2->name[0] == '\\')
-					id1 = id2;
-				else if (w1->name[0] == '\\' && w2->name[0] == '$')
-					continue;
-				else if (edges[id1].size() < edges[id2].size())
-					id1 = id2;
-				else if (edges[id1].size() > edges[id2].size())
+				}
+
+				int id2 = fanin_data[k++];
+				if (node_scc[id2] != this_scc)
 					continue;
-				else if (w2->name.str() < w1->name.str())
-					id1 = id2;
-			}
 
-			if (edges[id1].size() == 0) {
-				edges.erase(id1);
-				continue;
+				if (dfs_state[id2] == 0) {
+					call_stack.push_back(std::pair<int, int>(id2, fanin_begin[id2]));
+					dfs_state[id2] = 1;
+				} else if (dfs_state[id2] == 1) {
+					if (breaker_edges.count(id2) == 0)
+						breaker_nodes.push_back(id2);
+					breaker_edges[id2].push_back(id);
+				}
 			}
+		}
+	}
 
-			log_assert(signal_list[id1].bit.wire != NULL);
+	// insert a new signal for each selected loop breaker and re-route the feedback edges through it
 
-			std::stringstream sstr;
-			sstr << "$abcloop$" << (autoidx++);
-			RTLIL::Wire *wire = module->addWire(sstr.str());
+	for (int id1 : breaker_nodes)
+	{
+		log_assert(signal_list[id1].bit.wire != NULL);
 
-			bool first_line = true;
-			for (int id2 : edges[id1]) {
-				if (first_line)
-					log("Breaking loop using new signal %s: %s -> %s\n", log_signal(RTLIL::SigSpec(wire)),
-							log_signal(signal_list[id1].bit), log_signal(signal_list[id2].bit));
-				else
-					log("                               %*s  %s -> %s\n", int(strlen(log_signal(RTLIL::SigSpec(wire)))), "",
-							log_signal(signal_list[id1].bit), log_signal(signal_list[id2].bit));
-				first_line = false;
-			}
+		std::stringstream sstr;
+		sstr << "$abcloop$" << (autoidx++);
+		RTLIL::Wire *wire = module->addWire(sstr.str());
 
-			int id3 = map_signal(RTLIL::SigSpec(wire));
-			signal_list[id1].is_port = true;
-			signal_list[id3].is_port = true;
-			log_assert(id3 == int(in_edges_count.size()));
-			in_edges_count.push_back(0);
-			workpool.insert(id3);
-
-			for (int id2 : edges[id1]) {
-				if (signal_list[id2].in1 == id1)
-					signal_list[id2].in1 = id3;
-				if (signal_list[id2].in2 == id1)
-					signal_list[id2].in2 = id3;
-				if (signal_list[id2].in3 == id1)
-					signal_list[id2].in3 = id3;
-				if (signal_list[id2].in4 == id1)
-					signal_list[id2].in4 = id3;
-			}
-			edges[id1].swap(edges[id3]);
+		bool first_line = true;
+		for (int id2 : breaker_edges.at(id1)) {
+			if (first_line)
+				log("Breaking loop using new signal %s: %s -> %s\n", log_signal(RTLIL::SigSpec(wire)),
+						log_signal(signal_list[id1].bit), log_signal(signal_list[id2].bit));
+			else
+				log("                               %*s  %s -> %s\n", int(strlen(log_signal(RTLIL::SigSpec(wire)))), "",
+						log_signal(signal_list[id1].bit), log_signal(signal_list[id2].bit));
+			first_line = false;
+		}
 
-			module->connect(RTLIL::SigSig(signal_list[id3].bit, signal_list[id1].bit));
-			dump_loop_graph(dot_f, dot_nr, edges, workpool, in_edges_count);
+		int id3 = map_signal(RTLIL::SigSpec(wire));
+		signal_list[id1].is_port = true;
+		signal_list[id3].is_port = true;
+
+		for (int id2 : breaker_edges.at(id1)) {
+			if (signal_list[id2].in1 == id1)
+				signal_list[id2].in1 = id3;
+			if (signal_list[id2].in2 == id1)
+				signal_list[id2].in2 = id3;
+			if (signal_list[id2].in3 == id1)
+				signal_list[id2].in3 = id3;
+			if (signal_list[id2].in4 == id1)
+				signal_list[id2].in4 = id3;
 		}
-	}
 
-	if (dot_f != NULL)
-		fclose(dot_f);
+		module->connect(RTLIL::SigSig(signal_list[id3].bit, signal_list[id1].bit));
+	}
 }
 
 std::string add_echos_to_abc_cmd(std::string str)
@@ -0,0 +1,217 @@
+/*
+ *  yosys -- Yosys Open SYnthesis Suite
+ *
+ *  Copyright (C) 2012  Clifford Wolf <clifford@clifford.at>
+ *
+ *  Permission to use, copy, modify, and/or distribute this software for any
+ *  purpose with or without fee is hereby granted, provided that the above
+ *  copyright notice and this permission notice appear in all copies.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ *  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ *  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ *  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ *  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ *  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ *  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ *
+ */
+
+#include "kernel/register.h"
+#include "kernel/log.h"
+#include "backends/ilang/ilang_backend.h"
+#include "libs/sha1/sha1.h"
+#include <sstream>
+
+USING_YOSYS_NAMESPACE
+PRIVATE_NAMESPACE_BEGIN
+
+struct DedupWorker
+{
+	RTLIL::Design *design;
+	int merge_count;
+
+	DedupWorker(RTLIL::Design *design) : design(design), merge_count(0) { }
+
+	// The signature is the ilang dump of the module body without 'src' attributes. Auto-generated
+	// ($-prefixed) names of objects in the module are replaced by their index in order of appearance,
+	// so that modules created from the same code (e.g. derived with differently spelled parameters,
+	// or read from different files) get the same signature. Port names are kept, as instances
+	// connect to ports by name.
+	std::string module_signature(RTLIL::Module *module)
+	{
+		std::stringstream f;
+
+		for (auto &it : module->attributes)
+			if (it.first != "\\src" && it.first != "\\top") {
+				f << "attribute " << it.first.str() << " ";
+				ILANG_BACKEND::dump_const(f, it.second);
+				f << "\n";
+			}
+
+		for (auto wire : module->wires())
+			ILANG_BACKEND::dump_wire(f, "", wire);
+		for (auto &it : module->memories)
+			ILANG_BACKEND::dump_memory(f, "", it.second);
+		for (auto cell : module->cells())
+			ILANG_BACKEND::dump_cell(f, "", cell);
+		for (auto &it : module->processes)
+			ILANG_BACKEND::dump_proc(f, "", it.second);
+		for (auto &it : module->connections())
+			ILANG_BACKEND::dump_conn(f, "", it.first, it.second);
+
+		pool<std::string> local_names;
+		for (auto wire : module->wires())
+			if (wire->name[0] == '$' && wire->port_id == 0)
+				local_names.insert(wire->name.str());
+		for (auto cell : module->cells())
+			if (cell->name[0] == '$')
+				local_names.insert(cell->name.str());
+		for (auto &it : module->memories)
+			if (it.first[0] == '$')
+				local_names.insert(it.first.str());
+		for (auto &it : module->processes)
+			if (it.first[0] == '$')
+				local_names.insert(it.first.str());
+
+		dict<std::string, int> local_index;
+		std::string signature, line;
+
+		while (std::getline(f, line))
+		{
+			size_t pos = line.find_first_not_of(" \t");
+			if (pos != std::string::npos && line.compare(pos, 15, "attribute \\src ") == 0)
+				continue;
+
+			for (pos = 0; pos < line.size();)
+			{
+				if (line[pos] == ' ' || line[pos] == '\t') {
+					signature += line[pos++];
+					continue;
+				}
+
+				size_t end = line.find_first_of(" \t", pos);
+				if (end == std::string::npos)
+					end = line.size();
+
+				std::string token = line.substr(pos, end-pos);
+				bool quoted = GetSize(token) > 2 && token.front() == '"' && token.back() == '"';
+				std::string name = quoted ? token.substr(1, GetSize(token)-2) : token;
+
+				if (local_names.count(name)) {
+					if (local_index.count(name) == 0) {
+						int idx = GetSize(local_index);
+						local_index[name] = idx;
+					}
+					name = stringf("$%d", local_index.at(name));
+					token = quoted ? "\"" + name + "\"" : name;
+				}
+
+				signature += token;
+				pos = end;
+			}
+
+			signature += "\n";
+		}
+
+		return sha1(signature);
+	}
+
+	bool run_iteration()
+	{
+		pool<RTLIL::IdString> parametrized_modules;
+		for (auto module : design->modules())
+			for (auto cell : module->cells())
+				if (!cell->parameters.empty())
+					parametrized_modules.insert(cell->type);
+
+		// visit 'top' modules first so they are never replaced by another module,
+		// otherwise the module with the smallest name is kept
+		std::vector<RTLIL::Module*> modules, other_modules;
+		for (auto module : design->modules())
+			if (module->get_bool_attribute("\\top"))
+				modules.push_back(module);
+			else
+				other_modules.push_back(module);
+
+		std::sort(other_modules.begin(), other_modules.end(), RTLIL::sort_by_name_str<RTLIL::Module>());
+		modules.insert(modules.end(), other_modules.begin(), other_modules.end());
+
+		dict<std::string, RTLIL::Module*> signature_to_module;
+		dict<RTLIL::IdString, RTLIL::IdString> replace_modules;
+
+		for (auto module : modules)
+		{
+			if (!design->selected_whole_module(module->name) || module->get_bool_attribute("\\blackbox") ||
+					parametrized_modules.count(module->name))
+				continue;
+
+			std::string signature = module_signature(module);
+
+			if (signature_to_module.count(signature) == 0) {
+				signature_to_module[signature] = module;
+				continue;
+			}
+
+			RTLIL::Module *master = signature_to_module.at(signature);
+			if (module->get_bool_attribute("\\top"))
+				continue;
+
+			log("Merging module %s into identical module %s.\n", log_id(module), log_id(master));
+			replace_modules[module->name] = master->name;
+		}
+
+		if (replace_modules.empty())
+			return false;
+
+		for (auto module : design->modules())
+			for (auto cell : module->cells())
+				if (replace_modules.count(cell->type)) {
+					cell->type = replace_modules.at(cell->type);
+					module->modcount_++;
+				}
+
+		for (auto &it : replace_modules)
+			design->remove(design->module(it.first));
+
+		merge_count += GetSize(replace_modules);
+		return true;
+	}
+};
+
+struct DedupPass : public Pass {
+	DedupPass() : Pass("dedup", "merge structurally identical modules") { }
+	virtual void help()
+	{
+		//   |---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|
+		log("\n");
+		log("    dedup [selection]\n");
+		log("\n");
+		log("This pass finds selected modules that are structurally identical and merges\n");
+		log("them into one module, changing the type of all instances accordingly. This is\n");
+		log("useful after 'hierarchy', e.g. when the same module has been derived with\n");
+		log("different but equivalent parameter values, so that subsequent passes do not\n");
+		log("need to process the same logic more than once.\n");
+		log("\n");
+		log("Two modules are considered identical if they only differ in the module name,\n");
+		log("'src' attributes and auto-generated (\"$\"-prefixed) object names. Blackbox\n");
+		log("modules and modules that are still instantiated with parameters are ignored.\n");
+		log("Modules with the 'top' attribute are never removed.\n");
+		log("\n");
+		log("The pass is repeated until no more duplicates are found, so that parents of\n");
+		log("merged modules can be merged as well.\n");
+		log("\n");
+	}
+	virtual void execute(std::vector<std::string> args, RTLIL::Design *design)
+	{
+		log_header("Executing DEDUP pass (merging identical modules).\n");
+		extra_args(args, 1, design);
+
+		DedupWorker worker(design);
+		while (worker.run_iteration()) { }
+
+		log("Removed %d duplicate modules.\n", worker.merge_count);
+	}
+} DedupPass;
+
+PRIVATE_NAMESPACE_END
@@ -945,11 +945,42 @@ grow_read_ports:;
 	return true;
 }
 
-void handle_cell(Cell *cell, const rules_t &rules)
+// The rule search only depends on the memory parameters, on whether the memory
+// has init data, and on which of the enable and clock bits are identical. Memories
+// that agree in these properties are mapped using the same rule.
+string mapping_signature(Cell *cell, bool cell_init)
+{
+	string sig = cell_init ? "init" : "noinit";
+
+	for (auto param : {"\\SIZE", "\\ABITS", "\\WIDTH", "\\OFFSET", "\\WR_PORTS", "\\RD_PORTS", "\\WR_CLK_ENABLE",
+			"\\WR_CLK_POLARITY", "\\RD_CLK_ENABLE", "\\RD_CLK_POLARITY", "\\RD_TRANSPARENT"})
+		sig += stringf(" %s", cell->getParam(param).as_string().c_str());
+
+	dict<SigBit, int> bit_index;
+	for (auto port : {"\\WR_EN", "\\WR_CLK", "\\RD_CLK"}) {
+		sig += " |";
+		for (auto bit : cell->getPort(port)) {
+			if (bit.wire == nullptr) {
+				sig += stringf(" %c", bit.data == State::S0 ? '0' : bit.data == State::S1 ? '1' : bit.data == State::Sx ? 'x' : 'z');
+				continue;
+			}
+			if (bit_index.count(bit) == 0) {
+				int idx = GetSize(bit_index);
+				bit_index[bit] = idx;
+			}
+			sig += stringf(" %d", bit_index.at(bit));
+		}
+	}
+
+	return sig;
+}
+
+void handle_cell(Cell *cell, const rules_t &rules, dict<string, pair<int, int>> &mapping_cache)
 {
 	log("Processing %s.%s:\n", log_id(cell->module), log_id(cell));
 
 	bool cell_init = !SigSpec(cell->getParam("\\INIT")).is_fully_undef();
+	string signature = mapping_signature(cell, cell_init);
 
 	dict<string, int> match_properties;
 	match_properties["words"]  = cell->getParam("\\SIZE").as_int();
@@ -965,6 +996,27 @@ void handle_cell(Cell *cell, const rules_t &rules)
 		log(" %s=%d", it.first.c_str(), it.second);
 	log("\n");
 
+	if (mapping_cache.count(signature))
+	{
+		pair<int, int> cached_rule = mapping_cache.at(signature);
+
+		if (cached_rule.first < 0) {
+			log("  No acceptable bram resources found (same as for a previous memory with identical properties).\n");
+			return;
+		}
+
+		auto &cached_match = rules.matches.at(cached_rule.first);
+		auto &cached_bram = rules.brams.at(cached_match.name).at(cached_rule.second);
+
+		log("  Using rule #%d for bram type %s (variant %d) from a previous memory with identical properties.\n",
+				cached_rule.first+1, log_id(cached_bram.name), cached_bram.variant);
+
+		if (replace_cell(cell, rules, cached_bram, cached_match, match_properties, 2))
+			return;
+
+		log("    Mapping to bram type %s failed, falling back to full rule search.\n", log_id(cached_match.name));
+	}
+
 	pool<pair<IdString, int>> failed_brams;
 	dict<pair<int, int>, std::tuple<int, int, int>> best_rule_cache;
 
@@ -1027,6 +1079,21 @@ void handle_cell(Cell *cell, const rules_t &rules)
 				goto next_match_rule;
 			}
 
+			// quick check for a condition that would make replace_cell() fail when assigning the write ports
+			{
+				int bram_wr_ports = 0;
+				for (int j = 0; j < bram.groups; j++)
+					if (bram.wrmode.at(j) == 1)
+						bram_wr_ports += bram.ports.at(j);
+
+				if (bram_wr_ports < match_properties["wports"]) {
+					log("    Rule #%d for bram type %s (variant %d) rejected: bram has only %d write ports.\n",
+							i+1, log_id(bram.name), bram.variant, bram_wr_ports);
+					failed_brams.insert(pair<IdString, int>(bram.name, bram.variant));
+					goto next_match_rule;
+				}
+			}
+
 			for (auto it : match.min_limits) {
 				if (it.first == "waste" || it.first == "dups" || it.first == "acells" || it.first == "dcells" || it.first == "cells")
 					continue;
@@ -1089,6 +1156,7 @@ void handle_cell(Cell *cell, const rules_t &rules)
 				auto &best_bram = rules.brams.at(rules.matches.at(best_rule.first).name).at(best_rule.second);
 				if (!replace_cell(cell, rules, best_bram, rules.matches.at(best_rule.first), match_properties, 2))
 					log_error("Mapping to bram type %s (variant %d) after pre-selection failed.\n", log_id(best_bram.name), best_bram.variant);
+				mapping_cache[signature] = best_rule;
 				return;
 			}
 
@@ -1097,11 +1165,13 @@ void handle_cell(Cell *cell, const rules_t &rules)
 				failed_brams.insert(pair<IdString, int>(bram.name, bram.variant));
 				goto next_match_rule;
 			}
+			mapping_cache[signature] = pair<int, int>(i, vi);
 			return;
 		}
 	}
 
 	log("  No acceptable bram resources found.\n");
+	mapping_cache[signature] = pair<int, int>(-1, -1);
 }
 
 struct MemoryBramPass : public Pass {
@@ -1212,10 +1282,12 @@ struct MemoryBramPass : public Pass {
 		}
 		extra_args(args, argidx, design);
 
+		dict<string, pair<int, int>> mapping_cache;
+
 		for (auto mod : design->selected_modules())
 		for (auto cell : mod->selected_cells())
 			if (cell->type == "$mem")
-				handle_cell(cell, rules);
+				handle_cell(cell, rules, mapping_cache);
 	}
 } MemoryBramPass;
 
@@ -19,168 +19,233 @@
 
 #include "kernel/register.h"
 #include "kernel/log.h"
+#include "kernel/sigtools.h"
 #include <stdlib.h>
 #include <sstream>
 
 USING_YOSYS_NAMESPACE
 PRIVATE_NAMESPACE_BEGIN
 
-void normalize_sig(RTLIL::Module *module, RTLIL::SigSpec &sig)
+struct MemoryDffWorker
 {
-	for (auto &conn : module->connections())
-		sig.replace(conn.first, conn.second);
-}
+	RTLIL::Module *module;
+	SigMap sigmap;
 
-bool find_sig_before_dff(RTLIL::Module *module, std::vector<RTLIL::Cell*> &dff_cells, RTLIL::SigSpec &sig, RTLIL::SigSpec &clk, bool &clk_polarity, bool after = false)
-{
-	normalize_sig(module, sig);
+	// sigmapped $dff Q and D bits -> (cell, bit index) in the order of dff_cells,
+	// an index of -1 marks a cell that has the bit more than once on that port
+	typedef dict<RTLIL::SigBit, std::vector<std::pair<RTLIL::Cell*, int>>> dff_index_t;
+	dff_index_t dff_by_q, dff_by_d;
 
-	for (auto &bit : sig)
+	MemoryDffWorker(RTLIL::Module *module) : module(module), sigmap(module)
 	{
-		if (bit.wire == NULL)
-			continue;
+		for (auto cell : module->cells())
+			if (cell->type == "$dff") {
+				index_dff_port(dff_by_q, cell, cell->getPort("\\Q"));
+				index_dff_port(dff_by_d, cell, cell->getPort("\\D"));
+			}
+	}
 
-		for (auto cell : dff_cells)
+	void index_dff_port(dff_index_t &index, RTLIL::Cell *cell, const RTLIL::SigSpec &sig)
+	{
+		std::vector<RTLIL::SigBit> bits = sigmap(sig);
+		for (int i = 0; i < GetSize(bits); i++)
 		{
-			if (clk != RTLIL::SigSpec(RTLIL::State::Sx)) {
-				if (cell->getPort("\\CLK") != clk)
-					continue;
-				if (cell->parameters["\\CLK_POLARITY"].as_bool() != clk_polarity)
-					continue;
-			}
+			if (bits[i].wire == NULL)
+				continue;
 
-			RTLIL::SigSpec q_norm = cell->getPort(after ? "\\D" : "\\Q");
-			normalize_sig(module, q_norm);
+			auto &entries = index[bits[i]];
+			bool found = false;
 
-			RTLIL::SigSpec d = q_norm.extract(bit, &cell->getPort(after ? "\\Q" : "\\D"));
-			if (d.size() != 1)
-				continue;
+			for (auto &entry : entries)
+				if (entry.first == cell) {
+					entry.second = -1;
+					found = true;
+				}
 
-			bit = d;
-			clk = cell->getPort("\\CLK");
-			clk_polarity = cell->parameters["\\CLK_POLARITY"].as_bool();
-			goto replaced_this_bit;
+			if (!found)
+				entries.push_back(std::make_pair(cell, i));
 		}
+	}
 
-		return false;
-	replaced_this_bit:;
+	void unindex_dff_port(dff_index_t &index, RTLIL::Cell *cell, const RTLIL::SigSpec &sig)
+	{
+		for (auto bit : sigmap(sig))
+		{
+			auto it = index.find(bit);
+			if (it == index.end())
+				continue;
+
+			auto &entries = it->second;
+			for (int i = 0; i < GetSize(entries); i++)
+				if (entries[i].first == cell)
+					entries.erase(entries.begin() + (i--));
+		}
 	}
 
-	return true;
-}
+	bool find_sig_before_dff(RTLIL::SigSpec &sig, RTLIL::SigSpec &clk, bool &clk_polarity, bool after = false)
+	{
+		dff_index_t &index = after ? dff_by_d : dff_by_q;
+		sigmap.apply(sig);
 
-void handle_wr_cell(RTLIL::Module *module, std::vector<RTLIL::Cell*> &dff_cells, RTLIL::Cell *cell)
-{
-	log("Checking cell `%s' in module `%s': ", cell->name.c_str(), module->name.c_str());
+		for (auto &bit : sig)
+		{
+			if (bit.wire == NULL)
+				continue;
 
-	RTLIL::SigSpec clk = RTLIL::SigSpec(RTLIL::State::Sx);
-	bool clk_polarity = 0;
+			auto it = index.find(bit);
+			if (it == index.end())
+				return false;
 
-	RTLIL::SigSpec sig_addr = cell->getPort("\\ADDR");
-	if (!find_sig_before_dff(module, dff_cells, sig_addr, clk, clk_polarity)) {
-		log("no (compatible) $dff for address input found.\n");
-		return;
-	}
+			for (auto &entry : it->second)
+			{
+				RTLIL::Cell *cell = entry.first;
 
-	RTLIL::SigSpec sig_data = cell->getPort("\\DATA");
-	if (!find_sig_before_dff(module, dff_cells, sig_data, clk, clk_polarity)) {
-		log("no (compatible) $dff for data input found.\n");
-		return;
-	}
+				if (clk != RTLIL::SigSpec(RTLIL::State::Sx)) {
+					if (cell->getPort("\\CLK") != clk)
+						continue;
+					if (cell->parameters["\\CLK_POLARITY"].as_bool() != clk_polarity)
+						continue;
+				}
 
-	RTLIL::SigSpec sig_en = cell->getPort("\\EN");
-	if (!find_sig_before_dff(module, dff_cells, sig_en, clk, clk_polarity)) {
-		log("no (compatible) $dff for enable input found.\n");
-		return;
-	}
+				if (entry.second < 0)
+					continue;
+
+				bit = cell->getPort(after ? "\\Q" : "\\D")[entry.second];
+				clk = cell->getPort("\\CLK");
+				clk_polarity = cell->parameters["\\CLK_POLARITY"].as_bool();
+				goto replaced_this_bit;
+			}
 
-	if (clk != RTLIL::SigSpec(RTLIL::State::Sx)) {
-		cell->setPort("\\CLK", clk);
-		cell->setPort("\\ADDR", sig_addr);
-		cell->setPort("\\DATA", sig_data);
-		cell->setPort("\\EN", sig_en);
-		cell->parameters["\\CLK_ENABLE"] = RTLIL::Const(1);
-		cell->parameters["\\CLK_POLARITY"] = RTLIL::Const(clk_polarity);
-		log("merged $dff to cell.\n");
-		return;
+			return false;
+		replaced_this_bit:;
+		}
+
+		return true;
 	}
 
-	log("no (compatible) $dff found.\n");
-}
+	void handle_wr_cell(RTLIL::Cell *cell)
+	{
+		log("Checking cell `%s' in module `%s': ", cell->name.c_str(), module->name.c_str());
 
-void disconnect_dff(RTLIL::Module *module, RTLIL::SigSpec sig)
-{
-	normalize_sig(module, sig);
-	sig.sort_and_unify();
+		RTLIL::SigSpec clk = RTLIL::SigSpec(RTLIL::State::Sx);
+		bool clk_polarity = 0;
 
-	std::stringstream sstr;
-	sstr << "$memory_dff_disconnected$" << (autoidx++);
+		RTLIL::SigSpec sig_addr = cell->getPort("\\ADDR");
+		if (!find_sig_before_dff(sig_addr, clk, clk_polarity)) {
+			log("no (compatible) $dff for address input found.\n");
+			return;
+		}
 
-	RTLIL::SigSpec new_sig = module->addWire(sstr.str(), sig.size());
+		RTLIL::SigSpec sig_data = cell->getPort("\\DATA");
+		if (!find_sig_before_dff(sig_data, clk, clk_polarity)) {
+			log("no (compatible) $dff for data input found.\n");
+			return;
+		}
 
-	for (auto cell : module->cells())
-		if (cell->type == "$dff") {
-			RTLIL::SigSpec new_q = cell->getPort("\\Q");
-			new_q.replace(sig, new_sig);
-			cell->setPort("\\Q", new_q);
+		RTLIL::SigSpec sig_en = cell->getPort("\\EN");
+		if (!find_sig_before_dff(sig_en, clk, clk_polarity)) {
+			log("no (compatible) $dff for enable input found.\n");
+			return;
 		}
-}
 
-void handle_rd_cell(RTLIL::Module *module, std::vector<RTLIL::Cell*> &dff_cells, RTLIL::Cell *cell)
-{
-	log("Checking cell `%s' in module `%s': ", cell->name.c_str(), module->name.c_str());
+		if (clk != RTLIL::SigSpec(RTLIL::State::Sx)) {
+			cell->setPort("\\CLK", clk);
+			cell->setPort("\\ADDR", sig_addr);
+			cell->setPort("\\DATA", sig_data);
+			cell->setPort("\\EN", sig_en);
+			cell->parameters["\\CLK_ENABLE"] = RTLIL::Const(1);
+			cell->parameters["\\CLK_POLARITY"] = RTLIL::Const(clk_polarity);
+			log("merged $dff to cell.\n");
+			return;
+		}
 
-	bool clk_polarity = 0;
+		log("no (compatible) $dff found.\n");
+	}
 
-	RTLIL::SigSpec clk_data = RTLIL::SigSpec(RTLIL::State::Sx);
-	RTLIL::SigSpec sig_data = cell->getPort("\\DATA");
-	if (find_sig_before_dff(module, dff_cells, sig_data, clk_data, clk_polarity, true) &&
-			clk_data != RTLIL::SigSpec(RTLIL::State::Sx))
+	void disconnect_dff(RTLIL::SigSpec sig)
 	{
-		disconnect_dff(module, sig_data);
-		cell->setPort("\\CLK", clk_data);
-		cell->setPort("\\DATA", sig_data);
-		cell->parameters["\\CLK_ENABLE"] = RTLIL::Const(1);
-		cell->parameters["\\CLK_POLARITY"] = RTLIL::Const(clk_polarity);
-		cell->parameters["\\TRANSPARENT"] = RTLIL::Const(0);
-		log("merged data $dff to cell.\n");
-		return;
+		sigmap.apply(sig);
+		sig.sort_and_unify();
+
+		std::stringstream sstr;
+		sstr << "$memory_dff_disconnected$" << (autoidx++);
+
+		RTLIL::SigSpec new_sig = module->addWire(sstr.str(), sig.size());
+
+		// only the $dff cells driving one of the bits can be affected
+		std::vector<RTLIL::Cell*> cells;
+		pool<RTLIL::Cell*> cells_seen;
+
+		for (auto bit : sig) {
+			auto it = dff_by_q.find(bit);
+			if (it != dff_by_q.end())
+				for (auto &entry : it->second)
+					if (cells_seen.insert(entry.first).second)
+						cells.push_back(entry.first);
+		}
+
+		for (auto cell : cells) {
+			RTLIL::SigSpec old_q = cell->getPort("\\Q");
+			RTLIL::SigSpec new_q = old_q;
+			new_q.replace(sig, new_sig);
+			if (new_q == old_q)
+				continue;
+			unindex_dff_port(dff_by_q, cell, old_q);
+			cell->setPort("\\Q", new_q);
+			index_dff_port(dff_by_q, cell, new_q);
+		}
 	}
 
-	RTLIL::SigSpec clk_addr = RTLIL::SigSpec(RTLIL::State::Sx);
-	RTLIL::SigSpec sig_addr = cell->getPort("\\ADDR");
-	if (find_sig_before_dff(module, dff_cells, sig_addr, clk_addr, clk_polarity) &&
-			clk_addr != RTLIL::SigSpec(RTLIL::State::Sx))
+	void handle_rd_cell(RTLIL::Cell *cell)
 	{
-		cell->setPort("\\CLK", clk_addr);
-		cell->setPort("\\ADDR", sig_addr);
-		cell->parameters["\\CLK_ENABLE"] = RTLIL::Const(1);
-		cell->parameters["\\CLK_POLARITY"] = RTLIL::Const(clk_polarity);
-		cell->parameters["\\TRANSPARENT"] = RTLIL::Const(1);
-		log("merged address $dff to cell.\n");
-		return;
-	}
+		log("Checking cell `%s' in module `%s': ", cell->name.c_str(), module->name.c_str());
 
-	log("no (compatible) $dff found.\n");
-}
+		bool clk_polarity = 0;
 
-void handle_module(RTLIL::Module *module, bool flag_wr_only)
-{
-	std::vector<RTLIL::Cell*> dff_cells;
+		RTLIL::SigSpec clk_data = RTLIL::SigSpec(RTLIL::State::Sx);
+		RTLIL::SigSpec sig_data = cell->getPort("\\DATA");
+		if (find_sig_before_dff(sig_data, clk_data, clk_polarity, true) &&
+				clk_data != RTLIL::SigSpec(RTLIL::State::Sx))
+		{
+			disconnect_dff(sig_data);
+			cell->setPort("\\CLK", clk_data);
+			cell->setPort("\\DATA", sig_data);
+			cell->parameters["\\CLK_ENABLE"] = RTLIL::Const(1);
+			cell->parameters["\\CLK_POLARITY"] = RTLIL::Const(clk_polarity);
+			cell->parameters["\\TRANSPARENT"] = RTLIL::Const(0);
+			log("merged data $dff to cell.\n");
+			return;
+		}
 
-	for (auto cell : module->cells())
-		if (cell->type == "$dff")
-			dff_cells.push_back(cell);
+		RTLIL::SigSpec clk_addr = RTLIL::SigSpec(RTLIL::State::Sx);
+		RTLIL::SigSpec sig_addr = cell->getPort("\\ADDR");
+		if (find_sig_before_dff(sig_addr, clk_addr, clk_polarity) &&
+				clk_addr != RTLIL::SigSpec(RTLIL::State::Sx))
+		{
+			cell->setPort("\\CLK", clk_addr);
+			cell->setPort("\\ADDR", sig_addr);
+			cell->parameters["\\CLK_ENABLE"] = RTLIL::Const(1);
+			cell->parameters["\\CLK_POLARITY"] = RTLIL::Const(clk_polarity);
+			cell->parameters["\\TRANSPARENT"] = RTLIL::Const(1);
+			log("merged address $dff to cell.\n");
+			return;
+		}
 
-	for (auto cell : module->selected_cells())
-		if (cell->type == "$memwr" && !cell->parameters["\\CLK_ENABLE"].as_bool())
-			handle_wr_cell(module, dff_cells, cell);
+		log("no (compatible) $dff found.\n");
+	}
 
-	if (!flag_wr_only)
+	void run(bool flag_wr_only)
+	{
 		for (auto cell : module->selected_cells())
-			if (cell->type == "$memrd" && !cell->parameters["\\CLK_ENABLE"].as_bool())
-				handle_rd_cell(module, dff_cells, cell);
-}
+			if (cell->type == "$memwr" && !cell->parameters["\\CLK_ENABLE"].as_bool())
+				handle_wr_cell(cell);
+
+		if (!flag_wr_only)
+			for (auto cell : module->selected_cells())
+				if (cell->type == "$memrd" && !cell->parameters["\\CLK_ENABLE"].as_bool())
+					handle_rd_cell(cell);
+	}
+};
 
 struct MemoryDffPass : public Pass {
 	MemoryDffPass() : Pass("memory_dff", "merge input/output DFFs into memories") { }
@@ -214,8 +279,10 @@ struct MemoryDffPass : public Pass {
 		}
 		extra_args(args, argidx, design);
 
-		for (auto mod : design->selected_modules())
-			handle_module(mod, flag_wr_only);
+		for (auto mod : design->selected_modules()) {
+			MemoryDffWorker worker(mod);
+			worker.run(flag_wr_only);
+		}
 	}
 } MemoryDffPass;
  
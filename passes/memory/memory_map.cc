@@ -19,7 +19,6 @@
 
 #include "kernel/register.h"
 #include "kernel/log.h"
-#include <sstream>
 #include <set>
 #include <stdlib.h>
 
@@ -30,52 +29,89 @@ struct MemoryMapWorker
 {
 	RTLIL::Design *design;
 	RTLIL::Module *module;
+	bool wide_mode;
 
-	std::map<std::pair<RTLIL::SigSpec, RTLIL::SigSpec>, RTLIL::SigBit> decoder_cache;
+	dict<std::tuple<RTLIL::SigSpec, RTLIL::SigSpec, RTLIL::SigBit>, RTLIL::SigBit> decoder_cache;
 
 	std::string genid(RTLIL::IdString name, std::string token1 = "", int i = -1, std::string token2 = "", int j = -1, std::string token3 = "", int k = -1, std::string token4 = "")
 	{
-		std::stringstream sstr;
-		sstr << "$memory" << name.str() << token1;
-		
+		std::string str = "$memory" + name.str() + token1;
+
 		if (i >= 0)
-			sstr << "[" << i << "]";
+			str += stringf("[%d]", i);
 
-		sstr << token2;
+		str += token2;
 
 		if (j >= 0)
-			sstr << "[" << j << "]";
+			str += stringf("[%d]", j);
 
-		sstr << token3;
+		str += token3;
 
 		if (k >= 0)
-			sstr << "[" << k << "]";
+			str += stringf("[%d]", k);
 
-		sstr << token4 << "$" << (autoidx++);
-		return sstr.str();
+		str += token4 + stringf("$%d", autoidx++);
+		return str;
 	}
 
-	RTLIL::Wire *addr_decode(RTLIL::SigSpec addr_sig, RTLIL::SigSpec addr_val)
+	// when an enable signal is given it is folded into the lower half of the decoder,
+	// so that all decoder outputs with the same enable share the gating logic
+	RTLIL::Wire *addr_decode(RTLIL::SigSpec addr_sig, RTLIL::SigSpec addr_val, RTLIL::SigBit enable = RTLIL::State::S1)
 	{
-		std::pair<RTLIL::SigSpec, RTLIL::SigSpec> key(addr_sig, addr_val);
+		std::tuple<RTLIL::SigSpec, RTLIL::SigSpec, RTLIL::SigBit> key(addr_sig, addr_val, enable);
 		log_assert(GetSize(addr_sig) == GetSize(addr_val));
 
-		if (decoder_cache.count(key) == 0) {
+		auto it = decoder_cache.find(key);
+		if (it == decoder_cache.end()) {
+			RTLIL::SigBit bit;
 			if (GetSize(addr_sig) < 2) {
-				decoder_cache[key] = module->Eq(NEW_ID, addr_sig, addr_val);
+				if (enable == RTLIL::State::S1)
+					bit = module->Eq(NEW_ID, addr_sig, addr_val);
+				else
+					bit = module->And(NEW_ID, addr_decode(addr_sig, addr_val), enable);
 			} else {
 				int split_at = GetSize(addr_sig) / 2;
-				RTLIL::SigBit left_eq = addr_decode(addr_sig.extract(0, split_at), addr_val.extract(0, split_at));
+				RTLIL::SigBit left_eq = addr_decode(addr_sig.extract(0, split_at), addr_val.extract(0, split_at), enable);
 				RTLIL::SigBit right_eq = addr_decode(addr_sig.extract(split_at, GetSize(addr_sig) - split_at), addr_val.extract(split_at, GetSize(addr_val) - split_at));
-				decoder_cache[key] = module->And(NEW_ID, left_eq, right_eq);
+				bit = module->And(NEW_ID, left_eq, right_eq);
 			}
+			it = decoder_cache.insert(std::make_pair(key, bit)).first;
 		}
 
-		RTLIL::SigBit bit = decoder_cache.at(key);
+		RTLIL::SigBit bit = it->second;
 		log_assert(bit.wire != nullptr && GetSize(bit.wire) == 1);
 		return bit.wire;
 	}
 
+	RTLIL::Cell *add_dff(RTLIL::IdString name, int width, const RTLIL::SigSpec &clocks, const RTLIL::Const &clocks_pol)
+	{
+		RTLIL::Cell *c = module->addCell(name, "$dff");
+		c->parameters["\\WIDTH"] = RTLIL::Const(width);
+		if (clocks_pol.bits.size() > 0) {
+			c->parameters["\\CLK_POLARITY"] = RTLIL::Const(clocks_pol.bits[0]);
+			c->setPort("\\CLK", clocks.extract(0, 1));
+		} else {
+			c->parameters["\\CLK_POLARITY"] = RTLIL::Const(RTLIL::State::S1);
+			c->setPort("\\CLK", RTLIL::SigSpec(RTLIL::State::S0));
+		}
+		return c;
+	}
+
+	RTLIL::Wire *add_word_wire(RTLIL::Cell *cell, int i, int mem_width, const RTLIL::SigSpec &init_data)
+	{
+		std::string w_out_name = stringf("%s[%d]", cell->parameters["\\MEMID"].decode_string().c_str(), i);
+		if (module->wires_.count(w_out_name) > 0)
+			w_out_name = genid(cell->name, "", i, "$q");
+
+		RTLIL::Wire *w_out = module->addWire(w_out_name, mem_width);
+		SigSpec w_init = init_data.extract(i*mem_width, mem_width);
+
+		if (!w_init.is_fully_undef())
+			w_out->attributes["\\init"] = w_init.as_const();
+
+		return w_out;
+	}
+
 	void handle_cell(RTLIL::Cell *cell)
 	{
 		std::set<int> static_ports;
@@ -143,6 +179,9 @@ struct MemoryMapWorker
 		std::vector<RTLIL::SigSpec> data_reg_in;
 		std::vector<RTLIL::SigSpec> data_reg_out;
 
+		// in wide mode the Q outputs of all words are collected and driven by a single $dff cell
+		RTLIL::SigSpec wide_dff_q;
+
 		int count_static = 0;
 
 		for (int i = 0; i < mem_size; i++)
@@ -153,38 +192,47 @@ struct MemoryMapWorker
 				data_reg_out.push_back(static_cells_map[i]);
 				count_static++;
 			}
+			else if (wide_mode)
+			{
+				// the D input is created below, when the width of the $dff cell is known
+				data_reg_in.push_back(RTLIL::SigSpec());
+				data_reg_out.push_back(RTLIL::SigSpec(add_word_wire(cell, i, mem_width, init_data)));
+				wide_dff_q.append(data_reg_out.back());
+			}
 			else
 			{
-				RTLIL::Cell *c = module->addCell(genid(cell->name, "", i), "$dff");
-				c->parameters["\\WIDTH"] = cell->parameters["\\WIDTH"];
-				if (clocks_pol.bits.size() > 0) {
-					c->parameters["\\CLK_POLARITY"] = RTLIL::Const(clocks_pol.bits[0]);
-					c->setPort("\\CLK", clocks.extract(0, 1));
-				} else {
-					c->parameters["\\CLK_POLARITY"] = RTLIL::Const(RTLIL::State::S1);
-					c->setPort("\\CLK", RTLIL::SigSpec(RTLIL::State::S0));
-				}
+				RTLIL::Cell *c = add_dff(genid(cell->name, "", i), mem_width, clocks, clocks_pol);
 
 				RTLIL::Wire *w_in = module->addWire(genid(cell->name, "", i, "$d"), mem_width);
 				data_reg_in.push_back(RTLIL::SigSpec(w_in));
 				c->setPort("\\D", data_reg_in.back());
 
-				std::string w_out_name = stringf("%s[%d]", cell->parameters["\\MEMID"].decode_string().c_str(), i);
-				if (module->wires_.count(w_out_name) > 0)
-					w_out_name = genid(cell->name, "", i, "$q");
+				data_reg_out.push_back(RTLIL::SigSpec(add_word_wire(cell, i, mem_width, init_data)));
+				c->setPort("\\Q", data_reg_out.back());
+			}
+		}
 
-				RTLIL::Wire *w_out = module->addWire(w_out_name, mem_width);
-				SigSpec w_init = init_data.extract(i*mem_width, mem_width);
+		if (wide_mode)
+		{
+			if (GetSize(wide_dff_q) > 0)
+			{
+				RTLIL::Cell *c = add_dff(genid(cell->name), GetSize(wide_dff_q), clocks, clocks_pol);
+				c->setPort("\\Q", wide_dff_q);
 
-				if (!w_init.is_fully_undef())
-					w_out->attributes["\\init"] = w_init.as_const();
+				RTLIL::Wire *w_in = module->addWire(genid(cell->name, "", -1, "$d"), GetSize(wide_dff_q));
+				c->setPort("\\D", w_in);
 
-				data_reg_out.push_back(RTLIL::SigSpec(w_out));
-				c->setPort("\\Q", data_reg_out.back());
+				for (int i = 0, offset = 0; i < mem_size; i++)
+					if (GetSize(data_reg_in[i]) == 0) {
+						data_reg_in[i] = RTLIL::SigSpec(w_in, offset, mem_width);
+						offset += mem_width;
+					}
 			}
-		}
 
-		log("  created %d $dff cells and %d static cells of width %d.\n", mem_size-count_static, count_static, mem_width);
+			log("  created a $dff cell for %d words and %d static cells of width %d.\n", mem_size-count_static, count_static, mem_width);
+		}
+		else
+			log("  created %d $dff cells and %d static cells of width %d.\n", mem_size-count_static, count_static, mem_width);
 
 		int count_dff = 0, count_mux = 0, count_wrmux = 0;
 
@@ -259,6 +307,20 @@ struct MemoryMapWorker
 
 		log("  read interface: %d $dff and %d $mux cells.\n", count_dff, count_mux);
 
+		std::vector<RTLIL::SigSpec> wr_addr_sigs, wr_data_sigs, wr_en_sigs;
+
+		for (int j = 0; j < wr_ports; j++)
+		{
+			RTLIL::SigSpec wr_addr = cell->getPort("\\WR_ADDR").extract(j*mem_abits, mem_abits);
+
+			if (mem_offset)
+				wr_addr = module->Sub(NEW_ID, wr_addr, SigSpec(mem_offset, GetSize(wr_addr)));
+
+			wr_addr_sigs.push_back(wr_addr);
+			wr_data_sigs.push_back(cell->getPort("\\WR_DATA").extract(j*mem_width, mem_width));
+			wr_en_sigs.push_back(cell->getPort("\\WR_EN").extract(j*mem_width, mem_width));
+		}
+
 		for (int i = 0; i < mem_size; i++)
 		{
 			if (static_cells_map.count(i) > 0)
@@ -266,16 +328,13 @@ struct MemoryMapWorker
 
 			RTLIL::SigSpec sig = data_reg_out[i];
 
-			for (int j = 0; j < cell->parameters["\\WR_PORTS"].as_int(); j++)
+			for (int j = 0; j < wr_ports; j++)
 			{
-				RTLIL::SigSpec wr_addr = cell->getPort("\\WR_ADDR").extract(j*mem_abits, mem_abits);
-				RTLIL::SigSpec wr_data = cell->getPort("\\WR_DATA").extract(j*mem_width, mem_width);
-				RTLIL::SigSpec wr_en = cell->getPort("\\WR_EN").extract(j*mem_width, mem_width);
-
-				if (mem_offset)
-					wr_addr = module->Sub(NEW_ID, wr_addr, SigSpec(mem_offset, GetSize(wr_addr)));
+				const RTLIL::SigSpec &wr_addr = wr_addr_sigs[j];
+				const RTLIL::SigSpec &wr_data = wr_data_sigs[j];
+				const RTLIL::SigSpec &wr_en = wr_en_sigs[j];
 
-				RTLIL::Wire *w_seladdr = addr_decode(wr_addr, RTLIL::SigSpec(i, mem_abits));
+				RTLIL::Wire *w_seladdr = wide_mode ? nullptr : addr_decode(wr_addr, RTLIL::SigSpec(i, mem_abits));
 
 				int wr_offset = 0;
 				while (wr_offset < wr_en.size())
@@ -292,7 +351,11 @@ struct MemoryMapWorker
 
 					RTLIL::Wire *w = w_seladdr;
 
-					if (wr_bit != RTLIL::SigSpec(1, 1))
+					if (wide_mode)
+					{
+						w = addr_decode(wr_addr, RTLIL::SigSpec(i, mem_abits), wr_bit);
+					}
+					else if (wr_bit != RTLIL::SigSpec(1, 1))
 					{
 						RTLIL::Cell *c = module->addCell(genid(cell->name, "$wren", i, "", j, "", wr_offset), "$and");
 						c->parameters["\\A_SIGNED"] = RTLIL::Const(0);
@@ -330,7 +393,7 @@ struct MemoryMapWorker
 		module->remove(cell);
 	}
 
-	MemoryMapWorker(RTLIL::Design *design, RTLIL::Module *module) : design(design), module(module)
+	MemoryMapWorker(RTLIL::Design *design, RTLIL::Module *module, bool wide_mode) : design(design), module(module), wide_mode(wide_mode)
 	{
 		std::vector<RTLIL::Cell*> cells;
 		for (auto cell : module->selected_cells())
@@ -347,17 +410,37 @@ struct MemoryMapPass : public Pass {
 	{
 		//   |---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|
 		log("\n");
-		log("    memory_map [selection]\n");
+		log("    memory_map [options] [selection]\n");
 		log("\n");
 		log("This pass converts multiport memory cells as generated by the memory_collect\n");
 		log("pass to word-wide DFFs and address decoders.\n");
 		log("\n");
+		log("    -wide\n");
+		log("        Create a single $dff cell for all words of a memory instead of one\n");
+		log("        $dff cell per word, and merge the write enable signals into the\n");
+		log("        shared address decoders instead of creating an $and cell for each\n");
+		log("        word. This considerably reduces the number of cells and wires created\n");
+		log("        for large memories.\n");
+		log("\n");
 	}
-	virtual void execute(std::vector<std::string> args, RTLIL::Design *design) {
+	virtual void execute(std::vector<std::string> args, RTLIL::Design *design)
+	{
+		bool wide_mode = false;
+
 		log_header("Executing MEMORY_MAP pass (converting $mem cells to logic and flip-flops).\n");
-		extra_args(args, 1, design);
+
+		size_t argidx;
+		for (argidx = 1; argidx < args.size(); argidx++) {
+			if (args[argidx] == "-wide") {
+				wide_mode = true;
+				continue;
+			}
+			break;
+		}
+		extra_args(args, argidx, design);
+
 		for (auto mod : design->selected_modules())
-			MemoryMapWorker(design, mod);
+			MemoryMapWorker(design, mod, wide_mode);
 	}
 } MemoryMapPass;
  
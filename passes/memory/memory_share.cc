@@ -42,15 +42,16 @@ struct MemoryShareWorker
 	ModWalker modwalker;
 	CellTypes cone_ct;
 
-	std::map<RTLIL::SigBit, std::pair<RTLIL::Cell*, int>> sig_to_mux;
-	std::map<std::set<std::map<RTLIL::SigBit, bool>>, RTLIL::SigBit> conditions_logic_cache;
+	dict<RTLIL::SigBit, std::pair<RTLIL::Cell*, int>> sig_to_mux;
+	dict<RTLIL::SigSig, RTLIL::SigBit> condition_term_cache;
+	dict<RTLIL::SigSpec, RTLIL::SigBit> conditions_logic_cache;
 
 
 	// -----------------------------------------------------------------
 	// Converting feedbacks to async read ports to proper enable signals
 	// -----------------------------------------------------------------
 
-	bool find_data_feedback(const std::set<RTLIL::SigBit> &async_rd_bits, RTLIL::SigBit sig,
+	bool find_data_feedback(const pool<RTLIL::SigBit> &async_rd_bits, RTLIL::SigBit sig,
 			std::map<RTLIL::SigBit, bool> &state, std::set<std::map<RTLIL::SigBit, bool>> &conditions)
 	{
 		if (async_rd_bits.count(sig)) {
@@ -111,8 +112,8 @@ struct MemoryShareWorker
 
 	RTLIL::SigBit conditions_to_logic(std::set<std::map<RTLIL::SigBit, bool>> &conditions, int &created_conditions)
 	{
-		if (conditions_logic_cache.count(conditions))
-			return conditions_logic_cache.at(conditions);
+		// each condition is encoded as a (signal, value) pair of SigSpecs and the set of conditions
+		// as the SigSpec of the corresponding terms, so both levels can be looked up in hashed caches
 
 		RTLIL::SigSpec terms;
 		for (auto &cond : conditions) {
@@ -121,25 +122,34 @@ struct MemoryShareWorker
 				sig1.append_bit(it.first);
 				sig2.append_bit(it.second ? RTLIL::State::S1 : RTLIL::State::S0);
 			}
-			terms.append(module->Ne(NEW_ID, sig1, sig2));
-			created_conditions++;
+			RTLIL::SigSig key(sig1, sig2);
+			auto it = condition_term_cache.find(key);
+			if (it == condition_term_cache.end()) {
+				it = condition_term_cache.insert(std::make_pair(key, module->Ne(NEW_ID, sig1, sig2))).first;
+				created_conditions++;
+			}
+			terms.append(it->second);
 		}
 
-		if (terms.size() > 1)
-			terms = module->ReduceAnd(NEW_ID, terms);
+		if (terms.size() <= 1)
+			return terms;
+
+		auto it = conditions_logic_cache.find(terms);
+		if (it != conditions_logic_cache.end())
+			return it->second;
 
-		return conditions_logic_cache[conditions] = terms;
+		return conditions_logic_cache[terms] = module->ReduceAnd(NEW_ID, terms);
 	}
 
 	void translate_rd_feedback_to_en(std::string memid, std::vector<RTLIL::Cell*> &rd_ports, std::vector<RTLIL::Cell*> &wr_ports)
 	{
-		std::map<RTLIL::SigSpec, std::vector<std::set<RTLIL::SigBit>>> async_rd_bits;
-		std::map<RTLIL::SigBit, std::set<RTLIL::SigBit>> muxtree_upstream_map;
-		std::set<RTLIL::SigBit> non_feedback_nets;
+		dict<RTLIL::SigSpec, std::vector<pool<RTLIL::SigBit>>> async_rd_bits;
+		dict<RTLIL::SigBit, pool<RTLIL::SigBit>> muxtree_upstream_map;
+		pool<RTLIL::SigBit> non_feedback_nets;
 
-		for (auto wire_it : module->wires_)
-			if (wire_it.second->port_output) {
-				std::vector<RTLIL::SigBit> bits = RTLIL::SigSpec(wire_it.second);
+		for (auto wire : module->wires())
+			if (wire->port_output) {
+				std::vector<RTLIL::SigBit> bits = RTLIL::SigSpec(wire);
 				non_feedback_nets.insert(bits.begin(), bits.end());
 			}
 
@@ -158,9 +168,10 @@ struct MemoryShareWorker
 				non_feedback_nets.insert(sig_s.begin(), sig_s.end());
 
 				for (int i = 0; i < int(sig_y.size()); i++) {
-					muxtree_upstream_map[sig_y[i]].insert(sig_a[i]);
+					auto &upstream = muxtree_upstream_map[sig_y[i]];
+					upstream.insert(sig_a[i]);
 					for (int j = 0; j < int(sig_s.size()); j++)
-						muxtree_upstream_map[sig_y[i]].insert(sig_b[i + j*sig_y.size()]);
+						upstream.insert(sig_b[i + j*sig_y.size()]);
 				}
 
 				continue;
@@ -179,18 +190,18 @@ struct MemoryShareWorker
 			}
 		}
 
-		std::set<RTLIL::SigBit> expand_non_feedback_nets = non_feedback_nets;
+		pool<RTLIL::SigBit> expand_non_feedback_nets = non_feedback_nets;
 		while (!expand_non_feedback_nets.empty())
 		{
-			std::set<RTLIL::SigBit> new_expand_non_feedback_nets;
+			pool<RTLIL::SigBit> new_expand_non_feedback_nets;
 
-			for (auto &bit : expand_non_feedback_nets)
-				if (muxtree_upstream_map.count(bit))
-					for (auto &new_bit : muxtree_upstream_map.at(bit))
-						if (!non_feedback_nets.count(new_bit)) {
-							non_feedback_nets.insert(new_bit);
+			for (auto &bit : expand_non_feedback_nets) {
+				auto it = muxtree_upstream_map.find(bit);
+				if (it != muxtree_upstream_map.end())
+					for (auto &new_bit : it->second)
+						if (non_feedback_nets.insert(new_bit).second)
 							new_expand_non_feedback_nets.insert(new_bit);
-						}
+			}
 
 			expand_non_feedback_nets.swap(new_expand_non_feedback_nets);
 		}
@@ -207,9 +218,12 @@ struct MemoryShareWorker
 				if (non_feedback_nets.count(sig_data[i]))
 					goto not_pure_feedback_port;
 
-			async_rd_bits[sig_addr].resize(std::max(async_rd_bits.size(), sig_data.size()));
-			for (int i = 0; i < int(sig_data.size()); i++)
-				async_rd_bits[sig_addr][i].insert(sig_data[i]);
+			{
+				auto &addr_rd_bits = async_rd_bits[sig_addr];
+				addr_rd_bits.resize(std::max(addr_rd_bits.size(), sig_data.size()));
+				for (int i = 0; i < int(sig_data.size()); i++)
+					addr_rd_bits[i].insert(sig_data[i]);
+			}
 
 		not_pure_feedback_port:;
 		}
@@ -545,8 +559,8 @@ struct MemoryShareWorker
 		// create SAT representation of common input cone of all considered EN signals
 
 		pool<Wire*> one_hot_wires;
-		std::set<RTLIL::Cell*> sat_cells;
-		std::set<RTLIL::SigBit> bits_queue;
+		pool<RTLIL::Cell*> sat_cells;
+		pool<RTLIL::SigBit> bits_queue;
 		std::map<int, int> port_to_sat_variable;
 
 		for (int i = 0; i < int(wr_ports.size()); i++)
@@ -580,9 +594,10 @@ struct MemoryShareWorker
 		for (auto wire : one_hot_wires) {
 			log("  Adding one-hot constraint for wire %s.\n", log_id(wire));
 			vector<int> ez_wire_bits = satgen.importSigSpec(wire);
-			for (int i : ez_wire_bits)
-			for (int j : ez_wire_bits)
-				if (i != j) ez->assume(ez->NOT(i), j);
+			std::sort(ez_wire_bits.begin(), ez_wire_bits.end());
+			ez_wire_bits.erase(std::unique(ez_wire_bits.begin(), ez_wire_bits.end()), ez_wire_bits.end());
+			if (GetSize(ez_wire_bits) > 1)
+				ez->assume(ez->onehot(ez_wire_bits, true));
 		}
 
 		log("  Common input cone for all EN signals: %d cells.\n", int(sat_cells.size()));
@@ -61,6 +61,9 @@ struct OptPass : public Pass {
 		log("Note: Options in square brackets (such as [-keepdc]) are passed through to\n");
 		log("the opt_* commands when given to 'opt'.\n");
 		log("\n");
+		log("Within the loop, the opt_* passes skip modules that have not been modified\n");
+		log("since the same pass last processed them without finding anything to do.\n");
+		log("\n");
 		log("\n");
 	}
 	virtual void execute(std::vector<std::string> args, RTLIL::Design *design)
@@ -113,6 +116,12 @@ struct OptPass : public Pass {
 		}
 		extra_args(args, argidx, design);
 
+		// within this pass only the opt_* passes modify the design, so they can use the
+		// module modification counters to skip modules that did not change since their last run
+		for (auto module : design->modules())
+			module->modcount_stamps_.clear();
+		design->scratchpad_set_bool("opt.skip_unchanged", true);
+
 		if (fast_mode)
 		{
 			while (1) {
@@ -145,6 +154,10 @@ struct OptPass : public Pass {
 			}
 		}
 
+		design->scratchpad_unset("opt.skip_unchanged");
+		for (auto module : design->modules())
+			module->modcount_stamps_.clear();
+
 		design->optimize();
 		design->sort();
 		design->check();
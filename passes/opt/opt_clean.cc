@@ -184,17 +184,19 @@ void rmunused_module_signals(RTLIL::Module *module, bool purge_mode, bool verbos
 		}
 	}
 
-	module->connections_.clear();
+	std::vector<RTLIL::SigSig> new_connections;
 
 	SigPool used_signals;
 	SigPool used_signals_nodrivers;
 	for (auto &it : module->cells_) {
 		RTLIL::Cell *cell = it.second;
 		for (auto &it2 : cell->connections_) {
-			assign_map.apply(it2.second);
-			used_signals.add(it2.second);
+			RTLIL::SigSpec sig = assign_map(it2.second);
+			if (sig != it2.second)
+				cell->setPort(it2.first, sig);
+			used_signals.add(sig);
 			if (!ct.cell_output(cell->type, it2.first))
-				used_signals_nodrivers.add(it2.second);
+				used_signals_nodrivers.add(sig);
 		}
 	}
 	for (auto &it : module->wires_) {
@@ -232,7 +234,7 @@ void rmunused_module_signals(RTLIL::Module *module, bool purge_mode, bool verbos
 				if (new_conn.first.size() > 0) {
 					used_signals.add(new_conn.first);
 					used_signals.add(new_conn.second);
-					module->connect(new_conn);
+					new_connections.push_back(new_conn);
 				}
 			}
 		} else {
@@ -262,6 +264,9 @@ void rmunused_module_signals(RTLIL::Module *module, bool purge_mode, bool verbos
 	}
 
 
+	if (new_connections != module->connections())
+		module->new_connections(new_connections);
+
 	pool<RTLIL::Wire*> del_wires;
 
 	int del_wires_count = 0;
@@ -353,10 +358,18 @@ struct OptCleanPass : public Pass {
 		ct_reg.setup_internals_mem();
 		ct_reg.setup_stdcells_mem();
 
+		bool skip_unchanged = design->scratchpad_get_bool("opt.skip_unchanged");
+		std::string stamp_key = purge_mode ? "opt_clean -purge" : "opt_clean";
+
 		for (auto module : design->selected_whole_modules_warn()) {
 			if (module->has_processes_warn())
 				continue;
+			if (skip_unchanged && module->check_modcount_stamp(stamp_key))
+				continue;
+			unsigned int modcount = module->modcount_;
 			rmunused_module(module, purge_mode, true);
+			if (skip_unchanged)
+				module->set_modcount_stamp(stamp_key, modcount);
 		}
 
 		design->optimize();
@@ -19,12 +19,14 @@
 
 #include "kernel/register.h"
 #include "kernel/sigtools.h"
+#include "kernel/modtools.h"
 #include "kernel/celltypes.h"
 #include "kernel/utils.h"
 #include "kernel/log.h"
 #include <stdlib.h>
 #include <stdio.h>
 #include <algorithm>
+#include <deque>
 
 USING_YOSYS_NAMESPACE
 PRIVATE_NAMESPACE_BEGIN
@@ -73,7 +75,7 @@ void replace_undriven(RTLIL::Design *design, RTLIL::Module *module)
 	}
 }
 
-void replace_cell(SigMap &assign_map, RTLIL::Module *module, RTLIL::Cell *cell, std::string info, std::string out_port, RTLIL::SigSpec out_val)
+void replace_cell(RTLIL::Module *module, RTLIL::Cell *cell, std::string info, std::string out_port, RTLIL::SigSpec out_val)
 {
 	RTLIL::SigSpec Y = cell->getPort(out_port);
 	out_val.extend_u0(Y.size(), false);
@@ -82,13 +84,12 @@ void replace_cell(SigMap &assign_map, RTLIL::Module *module, RTLIL::Cell *cell,
 			cell->type.c_str(), cell->name.c_str(), info.c_str(),
 			module->name.c_str(), log_signal(Y), log_signal(out_val));
 	// log_cell(cell);
-	assign_map.add(Y, out_val);
 	module->connect(Y, out_val);
 	module->remove(cell);
 	did_something = true;
 }
 
-bool group_cell_inputs(RTLIL::Module *module, RTLIL::Cell *cell, bool commutative, SigMap &sigmap)
+bool group_cell_inputs(RTLIL::Module *module, RTLIL::Cell *cell, bool commutative, const SigMap &sigmap)
 {
 	std::string b_name = cell->hasPort("\\B") ? "\\B" : "\\A";
 
@@ -186,7 +187,88 @@ bool group_cell_inputs(RTLIL::Module *module, RTLIL::Cell *cell, bool commutativ
 	return true;
 }
 
-void replace_const_cells(RTLIL::Design *design, RTLIL::Module *module, bool consume_x, bool mux_undef, bool mux_bool, bool do_fine, bool keepdc)
+struct OptConstWorklist : public ModIndex
+{
+	// cells that still need to be looked at, [0] = without and [1] = with consume_x
+	std::deque<RTLIL::IdString> queue[2];
+	pool<RTLIL::IdString> queued[2];
+	CellTypes ct;
+
+	OptConstWorklist(RTLIL::Design *design, RTLIL::Module *module) : ModIndex(module), ct(design)
+	{
+		reload_module();
+	}
+
+	void enqueue(RTLIL::Cell *cell)
+	{
+		for (int i = 0; i < 2; i++)
+			if (queued[i].insert(cell->name).second)
+				queue[i].push_back(cell->name);
+	}
+
+	void enqueue_users(const RTLIL::SigSpec &sig)
+	{
+		if (auto_reload_module)
+			reload_module();
+
+		for (auto &bit : sigmap(sig)) {
+			auto it = database.find(bit);
+			if (it != database.end())
+				for (auto &port : it->second.ports)
+					enqueue(port.cell);
+		}
+	}
+
+	bool next(RTLIL::Cell *&cell, bool &consume_x)
+	{
+		// cells are only looked at with consume_x when no other cell is pending
+		for (int i = 0; i < 2; i++)
+			while (!queue[i].empty()) {
+				RTLIL::IdString name = queue[i].front();
+				queue[i].pop_front();
+				queued[i].erase(name);
+				cell = module->cell(name);
+				if (cell == nullptr)
+					continue;
+				consume_x = i == 1;
+				return true;
+			}
+		return false;
+	}
+
+	virtual void notify_connect(RTLIL::Cell *cell, const RTLIL::IdString &port, const RTLIL::SigSpec &old_sig, RTLIL::SigSpec &sig) YS_OVERRIDE
+	{
+		enqueue(cell);
+		if (!ct.cell_known(cell->type) || ct.cell_output(cell->type, port)) {
+			enqueue_users(old_sig);
+			enqueue_users(sig);
+		}
+		ModIndex::notify_connect(cell, port, old_sig, sig);
+	}
+
+	virtual void notify_connect(RTLIL::Module *mod, const RTLIL::SigSig &sigsig) YS_OVERRIDE
+	{
+		enqueue_users(sigsig.first);
+		enqueue_users(sigsig.second);
+		ModIndex::notify_connect(mod, sigsig);
+	}
+
+	virtual void notify_connect(RTLIL::Module *mod, const std::vector<RTLIL::SigSig> &sigsig) YS_OVERRIDE
+	{
+		ModIndex::notify_connect(mod, sigsig);
+		for (auto cell : module->cells())
+			enqueue(cell);
+	}
+
+	virtual void notify_blackout(RTLIL::Module *mod) YS_OVERRIDE
+	{
+		ModIndex::notify_blackout(mod);
+		for (auto cell : module->cells())
+			enqueue(cell);
+	}
+};
+
+void replace_const_cells(RTLIL::Design *design, RTLIL::Module *module, bool mux_undef, bool mux_bool, bool do_fine, bool keepdc)
 {
 	if (!design->selected(module))
 		return;
@@ -195,7 +277,10 @@ void replace_const_cells(RTLIL::Design *design, RTLIL::Module *module, bool cons
 	ct_combinational.setup_internals();
 	ct_combinational.setup_stdcells();
 
-	SigMap assign_map(module);
+	// the worklist keeps assign_map up to date and re-enqueues the cells
+	// connected to all signals that are changed while optimizing
+	OptConstWorklist worklist(design, module);
+	const SigMap &assign_map = worklist.sigmap;
 	dict<RTLIL::SigSpec, RTLIL::SigSpec> invert_map;
 
 	TopoSort<RTLIL::Cell*, RTLIL::IdString::compare_ptr_by_name<RTLIL::Cell>> cells;
@@ -228,8 +313,27 @@ void replace_const_cells(RTLIL::Design *design, RTLIL::Module *module, bool cons
 	cells.sort();
 
 	for (auto cell : cells.sorted)
+		worklist.enqueue(cell);
+
+	RTLIL::Cell *cell;
+	bool consume_x;
+
+	while (worklist.next(cell, consume_x))
 	{
-#define ACTION_DO(_p_, _s_) do { cover("opt.opt_const.action_" S__LINE__); replace_cell(assign_map, module, cell, input.as_string(), _p_, _s_); goto next_cell; } while (0)
+		if (!design->selected(module, cell) || cell->type[0] != '$')
+			continue;
+
+		if ((cell->type == "$_NOT_" || cell->type == "$not" || cell->type == "$logic_not") &&
+				cell->getPort("\\A").size() == 1 && cell->getPort("\\Y").size() == 1) {
+			RTLIL::SigSpec sig_y = assign_map(cell->getPort("\\Y"));
+			RTLIL::SigSpec sig_a = assign_map(cell->getPort("\\A"));
+			if (invert_map.count(sig_y) == 0 || invert_map.at(sig_y) != sig_a) {
+				invert_map[sig_y] = sig_a;
+				worklist.enqueue_users(sig_y);
+			}
+		}
+
+#define ACTION_DO(_p_, _s_) do { cover("opt.opt_const.action_" S__LINE__); replace_cell(module, cell, input.as_string(), _p_, _s_); goto next_cell; } while (0)
 #define ACTION_DO_Y(_v_) ACTION_DO("\\Y", RTLIL::SigSpec(RTLIL::State::S ## _v_))
 
 		if (do_fine)
@@ -320,13 +424,13 @@ void replace_const_cells(RTLIL::Design *design, RTLIL::Module *module, bool cons
 
 		if (cell->type == "$logic_or" && (assign_map(cell->getPort("\\A")) == RTLIL::State::S1 || assign_map(cell->getPort("\\B")) == RTLIL::State::S1)) {
 			cover("opt.opt_const.one_high");
-			replace_cell(assign_map, module, cell, "one high", "\\Y", RTLIL::State::S1);
+			replace_cell(module, cell, "one high", "\\Y", RTLIL::State::S1);
 			goto next_cell;
 		}
 
 		if (cell->type == "$logic_and" && (assign_map(cell->getPort("\\A")) == RTLIL::State::S0 || assign_map(cell->getPort("\\B")) == RTLIL::State::S0)) {
 			cover("opt.opt_const.one_low");
-			replace_cell(assign_map, module, cell, "one low", "\\Y", RTLIL::State::S0);
+			replace_cell(module, cell, "one low", "\\Y", RTLIL::State::S0);
 			goto next_cell;
 		}
 
@@ -356,9 +460,9 @@ void replace_const_cells(RTLIL::Design *design, RTLIL::Module *module, bool cons
 						"$lt", "$le", "$ge", "$gt", "$neg", "$add", "$sub", "$mul", "$div", "$mod", "$pow", cell->type.str());
 				if (cell->type == "$reduce_xor" || cell->type == "$reduce_xnor" ||
 						cell->type == "$lt" || cell->type == "$le" || cell->type == "$ge" || cell->type == "$gt")
-					replace_cell(assign_map, module, cell, "x-bit in input", "\\Y", RTLIL::State::Sx);
+					replace_cell(module, cell, "x-bit in input", "\\Y", RTLIL::State::Sx);
 				else
-					replace_cell(assign_map, module, cell, "x-bit in input", "\\Y", RTLIL::SigSpec(RTLIL::State::Sx, cell->getPort("\\Y").size()));
+					replace_cell(module, cell, "x-bit in input", "\\Y", RTLIL::SigSpec(RTLIL::State::Sx, cell->getPort("\\Y").size()));
 				goto next_cell;
 			}
 		}
@@ -366,7 +470,7 @@ void replace_const_cells(RTLIL::Design *design, RTLIL::Module *module, bool cons
 		if ((cell->type == "$_NOT_" || cell->type == "$not" || cell->type == "$logic_not") && cell->getPort("\\Y").size() == 1 &&
 				invert_map.count(assign_map(cell->getPort("\\A"))) != 0) {
 			cover_list("opt.opt_const.invert.double", "$_NOT_", "$not", "$logic_not", cell->type.str());
-			replace_cell(assign_map, module, cell, "double_invert", "\\Y", invert_map.at(assign_map(cell->getPort("\\A"))));
+			replace_cell(module, cell, "double_invert", "\\Y", invert_map.at(assign_map(cell->getPort("\\A"))));
 			goto next_cell;
 		}
 
@@ -492,7 +596,7 @@ void replace_const_cells(RTLIL::Design *design, RTLIL::Module *module, bool cons
 					cover_list("opt.opt_const.eqneq.isneq", "$eq", "$ne", "$eqx", "$nex", cell->type.str());
 					RTLIL::SigSpec new_y = RTLIL::SigSpec((cell->type == "$eq" || cell->type == "$eqx") ?  RTLIL::State::S0 : RTLIL::State::S1);
 					new_y.extend_u0(cell->parameters["\\Y_WIDTH"].as_int(), false);
-					replace_cell(assign_map, module, cell, "isneq", "\\Y", new_y);
+					replace_cell(module, cell, "isneq", "\\Y", new_y);
 					goto next_cell;
 				}
 				if (a[i] == b[i])
@@ -505,7 +609,7 @@ void replace_const_cells(RTLIL::Design *design, RTLIL::Module *module, bool cons
 				cover_list("opt.opt_const.eqneq.empty", "$eq", "$ne", "$eqx", "$nex", cell->type.str());
 				RTLIL::SigSpec new_y = RTLIL::SigSpec((cell->type == "$eq" || cell->type == "$eqx") ?  RTLIL::State::S1 : RTLIL::State::S0);
 				new_y.extend_u0(cell->parameters["\\Y_WIDTH"].as_int(), false);
-				replace_cell(assign_map, module, cell, "empty", "\\Y", new_y);
+				replace_cell(module, cell, "empty", "\\Y", new_y);
 				goto next_cell;
 			}
 
@@ -657,7 +761,7 @@ void replace_const_cells(RTLIL::Design *design, RTLIL::Module *module, bool cons
 		if (mux_bool && (cell->type == "$mux" || cell->type == "$_MUX_") &&
 				cell->getPort("\\A") == RTLIL::SigSpec(0, 1) && cell->getPort("\\B") == RTLIL::SigSpec(1, 1)) {
 			cover_list("opt.opt_const.mux_bool", "$mux", "$_MUX_", cell->type.str());
-			replace_cell(assign_map, module, cell, "mux_bool", "\\Y", cell->getPort("\\S"));
+			replace_cell(module, cell, "mux_bool", "\\Y", cell->getPort("\\S"));
 			goto next_cell;
 		}
 
@@ -727,7 +831,7 @@ void replace_const_cells(RTLIL::Design *design, RTLIL::Module *module, bool cons
 			if ((cell->getPort("\\A").is_fully_undef() && cell->getPort("\\B").is_fully_undef()) ||
 					cell->getPort("\\S").is_fully_undef()) {
 				cover_list("opt.opt_const.mux_undef", "$mux", "$pmux", cell->type.str());
-				replace_cell(assign_map, module, cell, "mux_undef", "\\Y", cell->getPort("\\A"));
+				replace_cell(module, cell, "mux_undef", "\\Y", cell->getPort("\\A"));
 				goto next_cell;
 			}
 			for (int i = 0; i < cell->getPort("\\S").size(); i++) {
@@ -746,12 +850,12 @@ void replace_const_cells(RTLIL::Design *design, RTLIL::Module *module, bool cons
 			}
 			if (new_s.size() == 0) {
 				cover_list("opt.opt_const.mux_empty", "$mux", "$pmux", cell->type.str());
-				replace_cell(assign_map, module, cell, "mux_empty", "\\Y", new_a);
+				replace_cell(module, cell, "mux_empty", "\\Y", new_a);
 				goto next_cell;
 			}
 			if (new_a == RTLIL::SigSpec(RTLIL::State::S0) && new_b == RTLIL::SigSpec(RTLIL::State::S1)) {
 				cover_list("opt.opt_const.mux_sel01", "$mux", "$pmux", cell->type.str());
-				replace_cell(assign_map, module, cell, "mux_sel01", "\\Y", new_s);
+				replace_cell(module, cell, "mux_sel01", "\\Y", new_s);
 				goto next_cell;
 			}
 			if (cell->getPort("\\S").size() != new_s.size()) {
@@ -782,7 +886,7 @@ void replace_const_cells(RTLIL::Design *design, RTLIL::Module *module, bool cons
 						cell->parameters["\\A_SIGNED"].as_bool(), false, \
 						cell->parameters["\\Y_WIDTH"].as_int())); \
 				cover("opt.opt_const.const.$" #_t); \
-				replace_cell(assign_map, module, cell, stringf("%s", log_signal(a)), "\\Y", y); \
+				replace_cell(module, cell, stringf("%s", log_signal(a)), "\\Y", y); \
 				goto next_cell; \
 			} \
 		}
@@ -797,7 +901,7 @@ void replace_const_cells(RTLIL::Design *design, RTLIL::Module *module, bool cons
 						cell->parameters["\\B_SIGNED"].as_bool(), \
 						cell->parameters["\\Y_WIDTH"].as_int())); \
 				cover("opt.opt_const.const.$" #_t); \
-				replace_cell(assign_map, module, cell, stringf("%s, %s", log_signal(a), log_signal(b)), "\\Y", y); \
+				replace_cell(module, cell, stringf("%s, %s", log_signal(a), log_signal(b)), "\\Y", y); \
 				goto next_cell; \
 			} \
 		}
@@ -1002,20 +1106,26 @@ struct OptConstPass : public Pass {
 		}
 		extra_args(args, argidx, design);
 
+		bool skip_unchanged = design->scratchpad_get_bool("opt.skip_unchanged");
+		std::string stamp_key = stringf("opt_const %d%d%d%d%d", mux_undef, mux_bool, undriven, do_fine, keepdc);
+
 		for (auto module : design->selected_modules())
 		{
+			bool use_stamp = skip_unchanged && design->selected_whole_module(module);
+			if (use_stamp && module->check_modcount_stamp(stamp_key))
+				continue;
+			unsigned int modcount = module->modcount_;
+
 			if (undriven)
 				replace_undriven(design, module);
 
-			do {
-				do {
-					did_something = false;
-					replace_const_cells(design, module, false, mux_undef, mux_bool, do_fine, keepdc);
-					if (did_something)
-						design->scratchpad_set_bool("opt.did_something", true);
-				} while (did_something);
-				replace_const_cells(design, module, true, mux_undef, mux_bool, do_fine, keepdc);
-			} while (did_something);
+			did_something = false;
+			replace_const_cells(design, module, mux_undef, mux_bool, do_fine, keepdc);
+			if (did_something)
+				design->scratchpad_set_bool("opt.did_something", true);
+
+			if (use_stamp)
+				module->set_modcount_stamp(stamp_key, modcount);
 		}
 
 		log_pop();
@@ -39,8 +39,8 @@ struct OptMuxtreeWorker
 
 	struct bitinfo_t {
 		bool seen_non_mux;
-		pool<int> mux_users;
-		pool<int> mux_drivers;
+		vector<int> mux_users;
+		vector<int> mux_drivers;
 	};
 
 	idict<SigBit> bit2num;
@@ -48,8 +48,8 @@ struct OptMuxtreeWorker
 
 	struct portinfo_t {
 		int ctrl_sig;
-		pool<int> input_sigs;
-		pool<int> input_muxes;
+		vector<int> input_sigs;
+		vector<int> input_muxes;
 		bool const_activated;
 		bool const_deactivated;
 		bool enabled;
@@ -65,6 +65,25 @@ struct OptMuxtreeWorker
 	vector<bool> root_enable_muxes;
 	pool<int> root_mux_rerun;
 
+	struct knowledge_t
+	{
+		// database of known inactive signals
+		// the payload is a reference counter used to manage the
+		// list. when it is non-zero the signal in known to be inactive
+		vector<int> known_inactive;
+
+		// database of known active signals
+		vector<int> known_active;
+
+		// this is just used to keep track of visited muxes in order to prohibit
+		// endless recursion in mux loops
+		vector<bool> visited_muxes;
+	};
+
+	// all counters and flags are back to zero after each eval_root_mux(),
+	// so one dense database indexed by bit2num is shared by all mux trees
+	knowledge_t knowledge;
+
 	OptMuxtreeWorker(RTLIL::Design *design, RTLIL::Module *module) :
 			design(design), module(module), assign_map(module), removed_count(0)
 	{
@@ -99,8 +118,8 @@ struct OptMuxtreeWorker
 					portinfo_t portinfo;
 					portinfo.ctrl_sig = sig2bits(ctrl_sig, false).front();
 					for (int idx : sig2bits(sig)) {
-						bit2info[idx].mux_users.insert(GetSize(mux2info));
-						portinfo.input_sigs.insert(idx);
+						add_mux_user(idx, GetSize(mux2info));
+						portinfo.input_sigs.push_back(idx);
 					}
 					portinfo.const_activated = ctrl_sig.is_fully_const() && ctrl_sig.as_bool();
 					portinfo.const_deactivated = ctrl_sig.is_fully_const() && !ctrl_sig.as_bool();
@@ -110,8 +129,8 @@ struct OptMuxtreeWorker
 
 				portinfo_t portinfo;
 				for (int idx : sig2bits(sig_a)) {
-					bit2info[idx].mux_users.insert(GetSize(mux2info));
-					portinfo.input_sigs.insert(idx);
+					add_mux_user(idx, GetSize(mux2info));
+					portinfo.input_sigs.push_back(idx);
 				}
 				portinfo.ctrl_sig = -1;
 				portinfo.const_activated = false;
@@ -119,8 +138,11 @@ struct OptMuxtreeWorker
 				portinfo.enabled = false;
 				muxinfo.ports.push_back(portinfo);
 
-				for (int idx : sig2bits(sig_y))
-					bit2info[idx].mux_drivers.insert(GetSize(mux2info));
+				for (int idx : sig2bits(sig_y)) {
+					vector<int> &drivers = bit2info[idx].mux_drivers;
+					if (drivers.empty() || drivers.back() != GetSize(mux2info))
+						drivers.push_back(GetSize(mux2info));
+				}
 
 				for (int idx : sig2bits(sig_s))
 					bit2info[idx].seen_non_mux = true;
@@ -148,24 +170,31 @@ struct OptMuxtreeWorker
 
 		// Populate mux2info[].ports[]:
 		//	.input_muxes
-		for (int i = 0; i < GetSize(bit2info); i++)
-		for (int j : bit2info[i].mux_users)
-		for (auto &p : mux2info[j].ports) {
-			if (p.input_sigs.count(i))
+		for (auto &mi : mux2info)
+		for (auto &p : mi.ports) {
+			for (int i : p.input_sigs)
 				for (int k : bit2info[i].mux_drivers)
-					p.input_muxes.insert(k);
+					p.input_muxes.push_back(k);
+			std::sort(p.input_muxes.begin(), p.input_muxes.end());
+			p.input_muxes.erase(std::unique(p.input_muxes.begin(), p.input_muxes.end()), p.input_muxes.end());
 		}
 
 		log("  Evaluating internal representation of mux trees.\n");
 
-		dict<int, pool<int>> mux_to_users;
+		// first user of each mux output, a mux with more than one
+		// distinct user is the root of a mux tree
+		vector<int> mux_first_user(GetSize(mux2info), -1);
 		root_muxes.resize(GetSize(mux2info));
 		root_enable_muxes.resize(GetSize(mux2info));
 
 		for (auto &bi : bit2info) {
 			for (int i : bi.mux_drivers)
-				for (int j : bi.mux_users)
-					mux_to_users[i].insert(j);
+				for (int j : bi.mux_users) {
+					if (mux_first_user[i] < 0)
+						mux_first_user[i] = j;
+					else if (mux_first_user[i] != j)
+						root_muxes.at(i) = true;
+				}
 			if (!bi.seen_non_mux)
 				continue;
 			for (int mux_idx : bi.mux_drivers) {
@@ -174,9 +203,9 @@ struct OptMuxtreeWorker
 			}
 		}
 
-		for (auto &it : mux_to_users)
-			if (GetSize(it.second) > 1)
-				root_muxes.at(it.first) = true;
+		knowledge.known_inactive.resize(GetSize(bit2info));
+		knowledge.known_active.resize(GetSize(bit2info));
+		knowledge.visited_muxes.resize(GetSize(mux2info));
 
 		for (int mux_idx = 0; mux_idx < GetSize(root_muxes); mux_idx++)
 			if (root_muxes.at(mux_idx)) {
@@ -258,6 +287,13 @@ struct OptMuxtreeWorker
 		}
 	}
 
+	void add_mux_user(int idx, int mux_idx)
+	{
+		vector<int> &users = bit2info[idx].mux_users;
+		if (users.empty() || users.back() != mux_idx)
+			users.push_back(mux_idx);
+	}
+
 	vector<int> sig2bits(RTLIL::SigSpec sig, bool skip_non_wires = true)
 	{
 		vector<int> results;
@@ -276,21 +312,6 @@ struct OptMuxtreeWorker
 		return results;
 	}
 
-	struct knowledge_t
-	{
-		// database of known inactive signals
-		// the payload is a reference counter used to manage the
-		// list. when it is non-zero the signal in known to be inactive
-		vector<int> known_inactive;
-
-		// database of known active signals
-		vector<int> known_active;
-
-		// this is just used to keep track of visited muxes in order to prohibit
-		// endless recursion in mux loops
-		vector<bool> visited_muxes;
-	};
-
 	void eval_mux_port(knowledge_t &knowledge, int mux_idx, int port_idx, bool do_replace_known, bool do_enable_ports, int abort_count)
 	{
 		muxinfo_t &muxinfo = mux2info[mux_idx];
@@ -438,12 +459,9 @@ struct OptMuxtreeWorker
 
 	void eval_root_mux(int mux_idx)
 	{
-		knowledge_t knowledge;
-		knowledge.known_inactive.resize(GetSize(bit2info));
-		knowledge.known_active.resize(GetSize(bit2info));
-		knowledge.visited_muxes.resize(GetSize(mux2info));
 		knowledge.visited_muxes[mux_idx] = true;
 		eval_mux(knowledge, mux_idx, true, root_enable_muxes.at(mux_idx), 3);
+		knowledge.visited_muxes[mux_idx] = false;
 	}
 };
 
@@ -467,12 +485,19 @@ struct OptMuxtreePass : public Pass {
 		log_header("Executing OPT_MUXTREE pass (detect dead branches in mux trees).\n");
 		extra_args(args, 1, design);
 
+		bool skip_unchanged = design->scratchpad_get_bool("opt.skip_unchanged");
+
 		int total_count = 0;
 		for (auto module : design->selected_whole_modules_warn()) {
 			if (module->has_processes_warn())
 				continue;
+			if (skip_unchanged && module->check_modcount_stamp("opt_muxtree"))
+				continue;
+			unsigned int modcount = module->modcount_;
 			OptMuxtreeWorker worker(design, module);
 			total_count += worker.removed_count;
+			if (skip_unchanged)
+				module->set_modcount_stamp("opt_muxtree", modcount);
 		}
 		if (total_count)
 			design->scratchpad_set_bool("opt.did_something", true);
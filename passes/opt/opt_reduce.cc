@@ -37,7 +37,7 @@ struct OptReduceWorker
 	int total_count;
 	bool did_something;
 
-	void opt_reduce(pool<RTLIL::Cell*> &cells, SigSet<RTLIL::Cell*> &drivers, RTLIL::Cell *cell)
+	void opt_reduce(pool<RTLIL::Cell*> &cells, dict<RTLIL::SigBit, pool<RTLIL::Cell*>> &drivers, RTLIL::Cell *cell)
 	{
 		if (cells.count(cell) == 0)
 			return;
@@ -70,7 +70,9 @@ struct OptReduceWorker
 			}
 
 			bool imported_children = false;
-			for (auto child_cell : drivers.find(bit)) {
+			auto drivers_it = drivers.find(bit);
+			if (drivers_it != drivers.end())
+			for (auto child_cell : drivers_it->second) {
 				if (child_cell->type == cell->type) {
 					opt_reduce(cells, drivers, child_cell);
 					if (child_cell->getPort("\\Y")[0] == bit) {
@@ -105,21 +107,31 @@ struct OptReduceWorker
 		RTLIL::SigSpec sig_s = assign_map(cell->getPort("\\S"));
 
 		RTLIL::SigSpec new_sig_b, new_sig_s;
-		pool<RTLIL::SigSpec> handled_sig;
 
-		handled_sig.insert(sig_a);
+		// group the B inputs by value (in order of first occurrence) and
+		// collect the control signals for each group
+		dict<RTLIL::SigSpec, int> b_groups;
+		std::vector<RTLIL::SigSpec> group_b, group_s;
+
 		for (int i = 0; i < sig_s.size(); i++)
 		{
 			RTLIL::SigSpec this_b = sig_b.extract(i*sig_a.size(), sig_a.size());
-			if (handled_sig.count(this_b) > 0)
+			if (this_b == sig_a)
 				continue;
 
-			RTLIL::SigSpec this_s = sig_s.extract(i, 1);
-			for (int j = i+1; j < sig_s.size(); j++) {
-				RTLIL::SigSpec that_b = sig_b.extract(j*sig_a.size(), sig_a.size());
-				if (this_b == that_b)
-					this_s.append(sig_s.extract(j, 1));
-			}
+			auto it = b_groups.find(this_b);
+			if (it == b_groups.end()) {
+				b_groups[this_b] = GetSize(group_b);
+				group_b.push_back(this_b);
+				group_s.push_back(sig_s[i]);
+			} else
+				group_s[it->second].append_bit(sig_s[i]);
+		}
+
+		for (int i = 0; i < GetSize(group_b); i++)
+		{
+			RTLIL::SigSpec &this_b = group_b[i];
+			RTLIL::SigSpec &this_s = group_s[i];
 
 			if (this_s.size() > 1)
 			{
@@ -136,7 +148,6 @@ struct OptReduceWorker
 
 			new_sig_b.append(this_b);
 			new_sig_s.append(this_s);
-			handled_sig.insert(this_b);
 		}
 
 		if (new_sig_s.size() != sig_s.size()) {
@@ -173,30 +184,34 @@ struct OptReduceWorker
 		std::vector<RTLIL::SigBit> new_sig_y;
 		RTLIL::SigSig old_sig_conn;
 
-		std::vector<std::vector<RTLIL::SigBit>> consolidated_in_tuples;
-		std::map<std::vector<RTLIL::SigBit>, RTLIL::SigBit> consolidated_in_tuples_map;
+		// the tuples are stored as SigSpecs so that each hash is only computed once
+		std::vector<RTLIL::SigSpec> consolidated_in_tuples;
+		dict<RTLIL::SigSpec, RTLIL::SigBit> consolidated_in_tuples_map;
 
 		for (int i = 0; i < int(sig_y.size()); i++)
 		{
-			std::vector<RTLIL::SigBit> in_tuple;
+			RTLIL::SigSpec in_tuple;
 			bool all_tuple_bits_same = true;
 
-			in_tuple.push_back(sig_a.at(i));
+			in_tuple.append_bit(sig_a.at(i));
 			for (int j = i; j < int(sig_b.size()); j += int(sig_a.size())) {
 				if (sig_b.at(j) != sig_a.at(i))
 					all_tuple_bits_same = false;
-				in_tuple.push_back(sig_b.at(j));
+				in_tuple.append_bit(sig_b.at(j));
 			}
 
 			if (all_tuple_bits_same)
 			{
 				old_sig_conn.first.append_bit(sig_y.at(i));
 				old_sig_conn.second.append_bit(sig_a.at(i));
+				continue;
 			}
-			else if (consolidated_in_tuples_map.count(in_tuple))
+
+			auto it = consolidated_in_tuples_map.find(in_tuple);
+			if (it != consolidated_in_tuples_map.end())
 			{
 				old_sig_conn.first.append_bit(sig_y.at(i));
-				old_sig_conn.second.append_bit(consolidated_in_tuples_map.at(in_tuple));
+				old_sig_conn.second.append_bit(it->second);
 			}
 			else
 			{
@@ -212,20 +227,15 @@ struct OptReduceWorker
 			log("      Old ports: A=%s, B=%s, Y=%s\n", log_signal(cell->getPort("\\A")),
 					log_signal(cell->getPort("\\B")), log_signal(cell->getPort("\\Y")));
 
-			cell->setPort("\\A", RTLIL::SigSpec());
-			for (auto &in_tuple : consolidated_in_tuples) {
-				RTLIL::SigSpec new_a = cell->getPort("\\A");
-				new_a.append(in_tuple.at(0));
-				cell->setPort("\\A", new_a);
-			}
-
-			cell->setPort("\\B", RTLIL::SigSpec());
+			RTLIL::SigSpec new_a, new_b;
+			for (auto &in_tuple : consolidated_in_tuples)
+				new_a.append_bit(in_tuple[0]);
 			for (int i = 1; i <= cell->getPort("\\S").size(); i++)
-				for (auto &in_tuple : consolidated_in_tuples) {
-					RTLIL::SigSpec new_b = cell->getPort("\\B");
-					new_b.append(in_tuple.at(i));
-					cell->setPort("\\B", new_b);
-				}
+				for (auto &in_tuple : consolidated_in_tuples)
+					new_b.append_bit(in_tuple[i]);
+
+			cell->setPort("\\A", new_a);
+			cell->setPort("\\B", new_b);
 
 			cell->parameters["\\WIDTH"] = RTLIL::Const(new_sig_y.size());
 			cell->setPort("\\Y", new_sig_y);
@@ -289,14 +299,16 @@ struct OptReduceWorker
 			const char *type_list[] = { "$reduce_or", "$reduce_and" };
 			for (auto type : type_list)
 			{
-				SigSet<RTLIL::Cell*> drivers;
+				dict<RTLIL::SigBit, pool<RTLIL::Cell*>> drivers;
 				pool<RTLIL::Cell*> cells;
 
 				for (auto &cell_it : module->cells_) {
 					RTLIL::Cell *cell = cell_it.second;
 					if (cell->type != type || !design->selected(module, cell))
 						continue;
-					drivers.insert(assign_map(cell->getPort("\\Y")), cell);
+					for (auto bit : assign_map(cell->getPort("\\Y")))
+						if (bit.wire != NULL)
+							drivers[bit].insert(cell);
 					cells.insert(cell);
 				}
 
@@ -370,8 +382,17 @@ struct OptReducePass : public Pass {
 		}
 		extra_args(args, argidx, design);
 
+		bool skip_unchanged = design->scratchpad_get_bool("opt.skip_unchanged");
+		std::string stamp_key = do_fine ? "opt_reduce -fine" : "opt_reduce";
+
 		int total_count = 0;
 		for (auto module : design->selected_modules())
+		{
+			bool use_stamp = skip_unchanged && design->selected_whole_module(module);
+			if (use_stamp && module->check_modcount_stamp(stamp_key))
+				continue;
+
+			unsigned int modcount = module->modcount_;
 			while (1) {
 				OptReduceWorker worker(design, module, do_fine);
 				total_count += worker.total_count;
@@ -379,6 +400,10 @@ struct OptReducePass : public Pass {
 					break;
 			}
 
+			if (use_stamp)
+				module->set_modcount_stamp(stamp_key, modcount);
+		}
+
 		if (total_count)
 			design->scratchpad_set_bool("opt.did_something", true);
 		log("Performed a total of %d changes.\n", total_count);
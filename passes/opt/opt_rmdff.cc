@@ -167,11 +167,18 @@ struct OptRmdffPass : public Pass {
 
 		extra_args(args, 1, design);
 
+		bool skip_unchanged = design->scratchpad_get_bool("opt.skip_unchanged");
+
 		for (auto &mod_it : design->modules_)
 		{
 			if (!design->selected(mod_it.second))
 				continue;
 
+			bool use_stamp = skip_unchanged && design->selected_whole_module(mod_it.second);
+			if (use_stamp && mod_it.second->check_modcount_stamp("opt_rmdff"))
+				continue;
+			unsigned int modcount = mod_it.second->modcount_;
+
 			assign_map.set(mod_it.second);
 			dff_init_map.set(mod_it.second);
 			for (auto &it : mod_it.second->wires_)
@@ -207,6 +214,9 @@ struct OptRmdffPass : public Pass {
 						handle_dff(mod_it.second, mod_it.second->cells_[id]))
 					total_count++;
 			}
+
+			if (use_stamp)
+				mod_it.second->set_modcount_stamp("opt_rmdff", modcount);
 		}
 
 		assign_map.clear();
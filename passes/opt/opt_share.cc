@@ -313,10 +313,19 @@ struct OptSharePass : public Pass {
 		}
 		extra_args(args, argidx, design);
 
+		bool skip_unchanged = design->scratchpad_get_bool("opt.skip_unchanged");
+		std::string stamp_key = mode_nomux ? "opt_share -nomux" : "opt_share";
+
 		int total_count = 0;
 		for (auto module : design->selected_modules()) {
+			bool use_stamp = skip_unchanged && design->selected_whole_module(module);
+			if (use_stamp && module->check_modcount_stamp(stamp_key))
+				continue;
+			unsigned int modcount = module->modcount_;
 			OptShareWorker worker(design, module, mode_nomux);
 			total_count += worker.total_count;
+			if (use_stamp)
+				module->set_modcount_stamp(stamp_key, modcount);
 		}
 
 		if (total_count)
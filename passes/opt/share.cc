@@ -23,6 +23,7 @@
 #include "kernel/modtools.h"
 #include "kernel/utils.h"
 #include "kernel/macc.h"
+#include "kernel/consteval.h"
 
 USING_YOSYS_NAMESPACE
 PRIVATE_NAMESPACE_BEGIN
@@ -60,6 +61,12 @@ struct ShareWorker
 
 	std::vector<std::pair<RTLIL::SigBit, RTLIL::SigBit>> exclusive_ctrls;
 
+	// one incremental SAT problem per module: control logic cells are only imported
+	// once and each query only adds the activation patterns as new expressions
+	ezSatPtr ez;
+	SatGen satgen;
+	pool<RTLIL::Cell*> sat_cells;
+
 
 	// ------------------------------------------------------------------------------
 	// Find terminal bits -- i.e. bits that do not (exclusively) feed into a mux tree
@@ -932,6 +939,116 @@ struct ShareWorker
 	}
 
 
+	// ----------------------------------------------------------------------------
+	// Random simulation of the control logic, used to avoid most of the SAT calls
+	// ----------------------------------------------------------------------------
+
+	// bit i of a value is the value of the signal for the i-th random input vector
+	struct sim_value_t {
+		uint64_t value, defined;
+	};
+
+	std::unique_ptr<ConstEval> sim_ce;
+	std::vector<SigMap> sim_states;
+	dict<RTLIL::SigBit, sim_value_t> sim_values;
+	uint64_t sim_valid_vectors;
+	uint32_t sim_rng_state;
+
+	uint32_t sim_rng()
+	{
+		// xorshift32
+		sim_rng_state ^= sim_rng_state << 13;
+		sim_rng_state ^= sim_rng_state >> 17;
+		sim_rng_state ^= sim_rng_state << 5;
+		return sim_rng_state;
+	}
+
+	void sim_signal(RTLIL::SigSpec sig)
+	{
+		RTLIL::SigSpec new_sig;
+		for (auto bit : modwalker.sigmap(sig))
+			if (bit.wire != nullptr && sim_values.count(bit) == 0) {
+				sim_values[bit] = sim_value_t();
+				new_sig.append_bit(bit);
+			}
+
+		if (new_sig.empty())
+			return;
+
+		for (int i = 0; i < GetSize(sim_states); i++)
+		{
+			sim_ce->values_map.swap(sim_states[i]);
+
+			RTLIL::SigSpec sig_values = new_sig, undef;
+			while (!sim_ce->eval(sig_values, undef) && !undef.empty()) {
+				RTLIL::Const rand_values(RTLIL::State::S0, GetSize(undef));
+				for (auto &b : rand_values.bits)
+					b = (sim_rng() & 1) != 0 ? RTLIL::State::S1 : RTLIL::State::S0;
+				sim_ce->set(undef, rand_values);
+				sig_values = new_sig;
+				undef = RTLIL::SigSpec();
+			}
+
+			for (int j = 0; j < GetSize(new_sig); j++) {
+				sim_value_t &v = sim_values.at(new_sig[j]);
+				if (sig_values[j] == RTLIL::State::S1)
+					v.value |= uint64_t(1) << i;
+				if (sig_values[j] == RTLIL::State::S0 || sig_values[j] == RTLIL::State::S1)
+					v.defined |= uint64_t(1) << i;
+			}
+
+			sim_ce->values_map.swap(sim_states[i]);
+		}
+	}
+
+	void sim_setup()
+	{
+		sim_ce.reset(new ConstEval(module));
+		sim_states.resize(64);
+		sim_rng_state = 123456789;
+
+		// only use input vectors that satisfy the constraints that are also passed to the SAT solver
+		sim_valid_vectors = ~uint64_t(0);
+		for (auto &it : exclusive_ctrls) {
+			sim_signal(it.first);
+			sim_signal(it.second);
+		}
+		for (auto &it : exclusive_ctrls) {
+			RTLIL::SigBit bit1 = modwalker.sigmap(it.first), bit2 = modwalker.sigmap(it.second);
+			uint64_t active1 = bit1.wire ? sim_values.at(bit1).value | ~sim_values.at(bit1).defined : (bit1 == RTLIL::State::S1 ? ~uint64_t(0) : 0);
+			uint64_t active2 = bit2.wire ? sim_values.at(bit2).value | ~sim_values.at(bit2).defined : (bit2 == RTLIL::State::S1 ? ~uint64_t(0) : 0);
+			sim_valid_vectors &= ~(active1 & active2);
+		}
+	}
+
+	uint64_t sim_activation_patterns(const pool<ssc_pair_t> &activation_patterns)
+	{
+		uint64_t active = 0;
+
+		for (auto &p : activation_patterns)
+		{
+			sim_signal(p.first);
+
+			std::vector<RTLIL::SigBit> p_bits = modwalker.sigmap(p.first);
+			uint64_t p_active = sim_valid_vectors;
+
+			for (int i = 0; i < GetSize(p_bits); i++) {
+				if (p_bits[i].wire == nullptr) {
+					if (p_bits[i].data != p.second.bits[i])
+						p_active = 0;
+					continue;
+				}
+				const sim_value_t &v = sim_values.at(p_bits[i]);
+				p_active &= v.defined & (p.second.bits[i] == RTLIL::State::S1 ? v.value : ~v.value);
+			}
+
+			active |= p_active;
+		}
+
+		return active;
+	}
+
+
 	// -------------------------------------------------------------------------------------
 	// Helper functions used to make sure that this pass does not introduce new logic loops.
 	// -------------------------------------------------------------------------------------
@@ -1061,7 +1178,7 @@ struct ShareWorker
 	}
 
 	ShareWorker(ShareWorkerConfig config, RTLIL::Design *design, RTLIL::Module *module) :
-			config(config), design(design), module(module), mi(module)
+			config(config), design(design), module(module), mi(module), satgen(ez.get(), &modwalker.sigmap)
 	{
 	#ifndef NDEBUG
 		bool before_scc = module_has_scc();
@@ -1102,6 +1219,8 @@ struct ShareWorker
 					if (bit < other_bit)
 						exclusive_ctrls.push_back(std::pair<RTLIL::SigBit, RTLIL::SigBit>(bit, other_bit));
 
+		sim_setup();
+
 		while (!shareable_cells.empty() && config.limit != 0)
 		{
 			RTLIL::Cell *cell = *shareable_cells.begin();
@@ -1180,10 +1299,15 @@ struct ShareWorker
 				optimize_activation_patterns(filtered_cell_activation_patterns);
 				optimize_activation_patterns(filtered_other_cell_activation_patterns);
 
-				ezSatPtr ez;
-				SatGen satgen(ez.get(), &modwalker.sigmap);
+				uint64_t sim_both_active = sim_activation_patterns(filtered_cell_activation_patterns) &
+						sim_activation_patterns(filtered_other_cell_activation_patterns);
 
-				pool<RTLIL::Cell*> sat_cells;
+				if (sim_both_active != 0) {
+					log("      According to random simulation this pair of cells can not be shared.\n");
+					continue;
+				}
+
+				pool<RTLIL::Cell*> cone_cells;
 				std::set<RTLIL::SigBit> bits_queue;
 
 				std::vector<int> cell_active, other_cell_active;
@@ -1214,26 +1338,32 @@ struct ShareWorker
 					bits_queue.clear();
 
 					for (auto &pbit : portbits)
-						if (sat_cells.count(pbit.cell) == 0 && cone_ct.cell_known(pbit.cell->type)) {
+						if (cone_cells.count(pbit.cell) == 0 && cone_ct.cell_known(pbit.cell->type)) {
 							if (config.opt_fast && modwalker.cell_outputs[pbit.cell].size() >= 4)
 								continue;
-							// log("      Adding cell %s (%s) to SAT problem.\n", log_id(pbit.cell), log_id(pbit.cell->type));
 							bits_queue.insert(modwalker.cell_inputs[pbit.cell].begin(), modwalker.cell_inputs[pbit.cell].end());
-							satgen.importCell(pbit.cell);
-							sat_cells.insert(pbit.cell);
+							cone_cells.insert(pbit.cell);
+							if (sat_cells.count(pbit.cell) == 0) {
+								// log("      Adding cell %s (%s) to SAT problem.\n", log_id(pbit.cell), log_id(pbit.cell->type));
+								satgen.importCell(pbit.cell);
+								sat_cells.insert(pbit.cell);
+							}
 						}
 
-					if (config.opt_fast && sat_cells.size() > 100)
+					if (config.opt_fast && cone_cells.size() > 100)
 						break;
 				}
 
+				std::vector<std::pair<RTLIL::SigBit, RTLIL::SigBit>> pending_exclusive_ctrls;
 				for (auto it : exclusive_ctrls)
 					if (satgen.importedSigBit(it.first) && satgen.importedSigBit(it.second)) {
 						log("      Adding exclusive control bits: %s vs. %s\n", log_signal(it.first), log_signal(it.second));
 						int sub1 = satgen.importSigBit(it.first);
 						int sub2 = satgen.importSigBit(it.second);
 						ez->assume(ez->NOT(ez->AND(sub1, sub2)));
-					}
+					} else
+						pending_exclusive_ctrls.push_back(it);
+				exclusive_ctrls.swap(pending_exclusive_ctrls);
 
 				if (!ez->solve(ez->expression(ez->OpOr, cell_active))) {
 					log("      According to the SAT solver the cell %s is never active. Sharing is pointless, we simply remove it.\n", log_id(cell));
@@ -1248,20 +1378,17 @@ struct ShareWorker
 					continue;
 				}
 
-				ez->non_incremental();
-
 				all_ctrl_signals.sort_and_unify();
 				std::vector<int> sat_model = satgen.importSigSpec(all_ctrl_signals);
 				std::vector<bool> sat_model_values;
 
 				int sub1 = ez->expression(ez->OpOr, cell_active);
 				int sub2 = ez->expression(ez->OpOr, other_cell_active);
-				ez->assume(ez->AND(sub1, sub2));
 
 				log("      Size of SAT problem: %d cells, %d variables, %d clauses\n",
-						GetSize(sat_cells), ez->numCnfVariables(), ez->numCnfClauses());
+						GetSize(cone_cells), ez->numCnfVariables(), ez->numCnfClauses());
 
-				if (ez->solve(sat_model, sat_model_values)) {
+				if (ez->solve(sat_model, sat_model_values, ez->AND(sub1, sub2))) {
 					log("      According to the SAT solver this pair of cells can not be shared.\n");
 					log("      Model from SAT solver: %s = %d'", log_signal(all_ctrl_signals), GetSize(sat_model_values));
 					for (int i = GetSize(sat_model_values)-1; i >= 0; i--)
@@ -1375,7 +1502,9 @@ struct SharePass : public Pass {
 		log("    share [options] [selection]\n");
 		log("\n");
 		log("This pass merges shareable resources into a single resource. A SAT solver\n");
-		log("is used to determine if two resources are share-able.\n");
+		log("is used to determine if two resources are share-able. Pairs of resources that\n");
+		log("are found to be active at the same time in a random simulation of the control\n");
+		log("logic are rejected without calling the SAT solver.\n");
 		log("\n");
 		log("  -force\n");
 		log("    Per default the selection of cells that is considered for sharing is\n");
@@ -20,6 +20,7 @@
 #include "kernel/yosys.h"
 #include "kernel/sigtools.h"
 #include "kernel/modtools.h"
+#include "kernel/knownbits.h"
 
 USING_YOSYS_NAMESPACE
 using namespace RTLIL;
@@ -48,12 +49,13 @@ struct WreduceWorker
 	WreduceConfig *config;
 	Module *module;
 	ModIndex mi;
+	KnownBits kb;
 
-	std::set<Cell*, IdString::compare_ptr_by_name<Cell>> work_queue_cells;
-	std::set<SigBit> work_queue_bits;
+	pool<Cell*> work_queue_cells;
+	pool<SigBit> work_queue_bits;
 
 	WreduceWorker(WreduceConfig *config, Module *module) :
-			config(config), module(module), mi(module) { }
+			config(config), module(module), mi(module), kb(mi) { }
 
 	void run_cell_mux(Cell *cell)
 	{
@@ -146,13 +148,9 @@ struct WreduceWorker
 			sig = sig.extract(0, max_port_size);
 		}
 
-		if (port_signed) {
-			while (GetSize(sig) > 1 && sig[GetSize(sig)-1] == sig[GetSize(sig)-2])
-				work_queue_bits.insert(sig[GetSize(sig)-1]), sig.remove(GetSize(sig)-1), bits_removed++;
-		} else {
-			while (GetSize(sig) > 1 && sig[GetSize(sig)-1] == S0)
-				work_queue_bits.insert(sig[GetSize(sig)-1]), sig.remove(GetSize(sig)-1), bits_removed++;
-		}
+		int min_width = std::max(kb.min_width(sig, port_signed), 1);
+		while (GetSize(sig) > min_width)
+			work_queue_bits.insert(sig[GetSize(sig)-1]), sig.remove(GetSize(sig)-1), bits_removed++;
 
 		if (bits_removed) {
 			log("Removed top %d bits (of %d) from port %c of cell %s.%s (%s).\n",
@@ -203,10 +201,15 @@ struct WreduceWorker
 		} else {
 			while (GetSize(sig) > 0)
 			{
-				auto info = mi.query(sig[GetSize(sig)-1]);
+				SigBit bit = sig[GetSize(sig)-1];
+				auto info = mi.query(bit);
 
-				if (info->is_output || GetSize(info->ports) > 1)
-					break;
+				if (info->is_output || GetSize(info->ports) > 1) {
+					// used bits can still be removed if their value is known
+					if (!kb.is_known(bit))
+						break;
+					module->connect(bit, kb.value(bit));
+				}
 
 				sig.remove(GetSize(sig)-1);
 				bits_removed++;
@@ -98,9 +98,9 @@ struct AlumaccWorker
 		}
 	};
 
-	std::map<RTLIL::SigBit, int> bit_users;
-	std::map<RTLIL::SigSpec, maccnode_t*> sig_macc;
-	std::map<RTLIL::SigSig, std::set<alunode_t*>> sig_alu;
+	dict<RTLIL::SigBit, int> bit_users;
+	dict<RTLIL::SigSpec, maccnode_t*> sig_macc;
+	dict<RTLIL::SigSig, std::vector<alunode_t*>> sig_alu;
 	int macc_counter, alu_counter;
 
 	AlumaccWorker(RTLIL::Module *module) : module(module), sigmap(module)
@@ -215,7 +215,7 @@ struct AlumaccWorker
 	{
 		while (1)
 		{
-			std::set<maccnode_t*> delete_nodes;
+			pool<maccnode_t*, hash_ptr_ops> delete_nodes;
 
 			for (auto &it : sig_macc)
 			{
@@ -228,10 +228,14 @@ struct AlumaccWorker
 				{
 					auto &port = n->macc.ports[i];
 
-					if (GetSize(port.in_b) > 0 || sig_macc.count(port.in_a) == 0)
+					if (GetSize(port.in_b) > 0)
 						continue;
 
-					auto other_n = sig_macc.at(port.in_a);
+					auto other_it = sig_macc.find(port.in_a);
+					if (other_it == sig_macc.end())
+						continue;
+
+					auto other_n = other_it->second;
 
 					if (other_n->users > 1)
 						continue;
@@ -267,7 +271,7 @@ struct AlumaccWorker
 
 	void macc_to_alu()
 	{
-		std::set<maccnode_t*> delete_nodes;
+		pool<maccnode_t*, hash_ptr_ops> delete_nodes;
 
 		for (auto &it : sig_macc)
 		{
@@ -335,7 +339,7 @@ struct AlumaccWorker
 			alunode->c = C;
 			alunode->y = n->y;
 
-			sig_alu[RTLIL::SigSig(A, B)].insert(alunode);
+			sig_alu[RTLIL::SigSig(A, B)].push_back(alunode);
 			delete_nodes.insert(n);
 		next_macc:;
 		}
@@ -397,8 +401,9 @@ struct AlumaccWorker
 			}
 
 			alunode_t *n = nullptr;
+			auto &nodes = sig_alu[RTLIL::SigSig(A, B)];
 
-			for (auto node : sig_alu[RTLIL::SigSig(A, B)])
+			for (auto node : nodes)
 				if (node->is_signed == is_signed && node->invert_b && node->c == RTLIL::S1) {
 					n = node;
 					break;
@@ -412,7 +417,7 @@ struct AlumaccWorker
 				n->y = module->addWire(NEW_ID, std::max(GetSize(A), GetSize(B)));
 				n->is_signed = is_signed;
 				n->invert_b = true;
-				sig_alu[RTLIL::SigSig(A, B)].insert(n);
+				nodes.push_back(n);
 				log(" new $alu\n");
 			} else {
 				log(" merged with %s.\n", log_id(n->cells.front()));
@@ -435,12 +440,14 @@ struct AlumaccWorker
 				std::swap(A, B);
 
 			alunode_t *n = nullptr;
+			auto it = sig_alu.find(RTLIL::SigSig(A, B));
 
-			for (auto node : sig_alu[RTLIL::SigSig(A, B)])
-				if (node->is_signed == is_signed && node->invert_b && node->c == RTLIL::S1) {
-					n = node;
-					break;
-				}
+			if (it != sig_alu.end())
+				for (auto node : it->second)
+					if (node->is_signed == is_signed && node->invert_b && node->c == RTLIL::S1) {
+						n = node;
+						break;
+					}
 
 			if (n != nullptr) {
 				log("  creating $alu model for %s (%s): merged with %s.\n", log_id(cell), log_id(cell->type), log_id(n->cells.front()));
@@ -461,7 +461,7 @@ struct DfflibmapPass : public Pass {
 	virtual void help()
 	{
 		log("\n");
-		log("    dfflibmap [-prepare] -liberty <file> [selection]\n");
+		log("    dfflibmap [-prepare] [-cache <cache_file>] -liberty <file> [selection]\n");
 		log("\n");
 		log("Map internal flip-flop cells to the flip-flop cells in the technology\n");
 		log("library specified in the given liberty file.\n");
@@ -473,12 +473,16 @@ struct DfflibmapPass : public Pass {
 		log("to the internal cell types that best match the cells found in the given\n");
 		log("liberty file.\n");
 		log("\n");
+		log("When called with -cache, the cells read from the liberty file are stored in\n");
+		log("the given cache file and read from there as long as the liberty file is\n");
+		log("unchanged. (the cache file can be shared with read_liberty -cache.)\n");
+		log("\n");
 	}
 	virtual void execute(std::vector<std::string> args, RTLIL::Design *design)
 	{
 		log_header("Executing DFFLIBMAP pass (mapping DFF cells to sequential cells from liberty file).\n");
 
-		std::string liberty_file;
+		std::string liberty_file, cache_file;
 		bool prepare_mode = false;
 
 		size_t argidx;
@@ -493,6 +497,10 @@ struct DfflibmapPass : public Pass {
 				prepare_mode = true;
 				continue;
 			}
+			if (arg == "-cache" && argidx+1 < args.size()) {
+				cache_file = args[++argidx];
+				continue;
+			}
 			break;
 		}
 		extra_args(args, argidx, design);
@@ -504,7 +512,7 @@ struct DfflibmapPass : public Pass {
 		f.open(liberty_file.c_str());
 		if (f.fail())
 			log_cmd_error("Can't open liberty file `%s': %s\n", liberty_file.c_str(), strerror(errno));
-		LibertyParser libparser(f);
+		LibertyParser libparser(f, liberty_file, cache_file);
 		f.close();
 
 		find_cell(libparser.ast, "$_DFF_N_", false, false, false, false, prepare_mode);
@@ -24,9 +24,13 @@
 #include <istream>
 #include <fstream>
 #include <iostream>
+#include <sstream>
+#include <memory>
 
 #ifndef FILTERLIB
 #include "kernel/log.h"
+#include <sys/stat.h>
+#include <errno.h>
 #endif
 
 using namespace Yosys;
@@ -82,71 +86,101 @@ void LibertyAst::dump(FILE *f, std::string indent, std::string path, bool path_o
 		fprintf(f, " ;\n");
 }
 
-int LibertyParser::lexer(std::string &str)
+LibertyParser::LibertyParser(std::istream &f) : f(&f), line(1), ast(NULL), buffer_pos(0), buffer_end(0), buffer_eof(false), reading_cache(false)
+{
+	ast = parse();
+}
+
+bool LibertyParser::fill_buffer()
+{
+	if (buffer.empty())
+		buffer.resize(1 << 16);
+
+	// keep the last character so that unget_char() also works across refills
+	size_t keep = 0;
+	if (buffer_pos > 0)
+		buffer[keep++] = buffer[buffer_pos-1];
+
+	f->read(&buffer[keep], buffer.size() - keep);
+	buffer_pos = keep;
+	buffer_end = keep + f->gcount();
+	return buffer_pos < buffer_end;
+}
+
+static inline bool is_id_char(int c)
+{
+	return ('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z') || ('0' <= c && c <= '9') || c == '_' || c == '-' || c == '+' || c == '.';
+}
+
+// str may be NULL when the token text is not needed (see skip_statement())
+int LibertyParser::lexer(std::string *str)
 {
 	int c;
 
 	do {
-		c = f.get();
+		c = get_char();
 	} while (c == ' ' || c == '\t' || c == '\r');
 
-	if (('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z') || ('0' <= c && c <= '9') || c == '_' || c == '-' || c == '+' || c == '.') {
-		str = c;
+	if (is_id_char(c)) {
+		if (str != NULL)
+			*str = c;
 		while (1) {
-			c = f.get();
-			if (('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z') || ('0' <= c && c <= '9') || c == '_' || c == '-' || c == '+' || c == '.')
-				str += c;
-			else
+			c = get_char();
+			if (!is_id_char(c))
 				break;
+			if (str != NULL)
+				*str += c;
 		}
-		f.unget();
-		// fprintf(stderr, "LEX: identifier >>%s<<\n", str.c_str());
+		unget_char();
+		// fprintf(stderr, "LEX: identifier >>%s<<\n", str->c_str());
 		return 'v';
 	}
 
 	if (c == '"') {
-		str = "";
+		if (str != NULL)
+			*str = "";
 		while (1) {
-			c = f.get();
+			c = get_char();
 			if (c == '\n')
 				line++;
-			if (c == '"')
+			if (c == '"' || c == EOF)
 				break;
-			str += c;
+			if (str != NULL)
+				*str += c;
 		}
-		// fprintf(stderr, "LEX: string >>%s<<\n", str.c_str());
+		// fprintf(stderr, "LEX: string >>%s<<\n", str->c_str());
 		return 'v';
 	}
 
 	if (c == '/') {
-		c = f.get();
+		c = get_char();
 		if (c == '*') {
 			int last_c = 0;
 			while (c > 0 && (last_c != '*' || c != '/')) {
 				last_c = c;
-				c = f.get();
+				c = get_char();
 				if (c == '\n')
 					line++;
 			}
 			return lexer(str);
 		} else if (c == '/') {
 			while (c > 0 && c != '\n')
-				c = f.get();
+				c = get_char();
 			line++;
 			return lexer(str);
 		}
-		f.unget();
+		unget_char();
 		// fprintf(stderr, "LEX: char >>/<<\n");
 		return '/';
 	}
 
 	if (c == '\\') {
-		c = f.get();
+		c = get_char();
 		if (c == '\r')
-			c = f.get();
+			c = get_char();
 		if (c == '\n')
 			return lexer(str);
-		f.unget();
+		unget_char();
 		return '\\';
 	}
 
@@ -162,33 +196,86 @@ int LibertyParser::lexer(std::string &str)
 	return c;
 }
 
+void LibertyParser::skip_statement()
+{
+	while (1)
+	{
+		int tok = lexer(NULL);
+
+		if (tok == ';')
+			break;
+
+		if (tok == ':') {
+			if (lexer(NULL) != 'v')
+				error();
+			continue;
+		}
+
+		if (tok == '(') {
+			while (1) {
+				tok = lexer(NULL);
+				if (tok == ')')
+					break;
+				if (tok != 'v' && tok != ',')
+					error();
+			}
+			continue;
+		}
+
+		if (tok == '{') {
+			for (int depth = 1; depth > 0;) {
+				tok = lexer(NULL);
+				if (tok == '{')
+					depth++;
+				if (tok == '}')
+					depth--;
+				if (tok < 0)
+					error();
+			}
+			break;
+		}
+
+		error();
+	}
+}
+
 LibertyAst *LibertyParser::parse()
 {
 	std::string str;
+	int tok;
 
-	int tok = lexer(str);
+	while (1)
+	{
+		tok = lexer(&str);
 
-	while (tok == ';')
-		tok = lexer(str);
+		while (tok == ';')
+			tok = lexer(&str);
 
-	if (tok == '}' || tok < 0)
-		return NULL;
-	
-	if (tok != 'v')
-		error();
+		if (tok == '}' || tok < 0)
+			return NULL;
+
+		if (tok != 'v')
+			error();
+
+		if (keep_ids.empty() || keep_ids.count(str))
+			break;
+
+		skip_statement();
+	}
 
-	LibertyAst *ast = new LibertyAst;
+	// owned here until it is returned, so that it is freed when error() throws
+	std::unique_ptr<LibertyAst> ast(new LibertyAst);
 	ast->id = str;
 
 	while (1)
 	{
-		tok = lexer(str);
+		tok = lexer(&str);
 
 		if (tok == ';')
 			break;
 
 		if (tok == ':' && ast->value.empty()) {
-			tok = lexer(ast->value);
+			tok = lexer(&ast->value);
 			if (tok != 'v')
 				error();
 			continue;
@@ -197,7 +284,7 @@ LibertyAst *LibertyParser::parse()
 		if (tok == '(') {
 			while (1) {
 				std::string arg;
-				tok = lexer(arg);
+				tok = lexer(&arg);
 				if (tok == ',')
 					continue;
 				if (tok == ')')
@@ -222,13 +309,124 @@ LibertyAst *LibertyParser::parse()
 		error();
 	}
 
-	return ast;
+	return ast.release();
 }
 
 #ifndef FILTERLIB
 
+static const char *cache_trailer = "/* end of yosys liberty cache */\n";
+
+struct LibertyCacheError { };
+
+static void write_cache_ast(std::ostream &f, LibertyAst *ast, std::string indent)
+{
+	f << indent << ast->id;
+	if (!ast->args.empty() || !ast->children.empty()) {
+		f << "(";
+		for (size_t i = 0; i < ast->args.size(); i++)
+			f << (i > 0 ? ", \"" : "\"") << ast->args[i] << "\"";
+		f << ")";
+	}
+	if (!ast->value.empty())
+		f << " : \"" << ast->value << "\"";
+	if (!ast->children.empty()) {
+		f << " {\n";
+		for (auto child : ast->children)
+			write_cache_ast(f, child, indent + "  ");
+		f << indent << "}\n";
+	} else
+		f << " ;\n";
+}
+
+LibertyParser::LibertyParser(std::istream &f, std::string filename, std::string cache_file) :
+		f(&f), line(1), ast(NULL), buffer_pos(0), buffer_end(0), buffer_eof(false), reading_cache(false)
+{
+	// everything read_liberty and dfflibmap look at, timing and power tables are skipped
+	keep_ids = { "library", "cell", "area", "pin", "direction", "function",
+			"ff", "latch", "clocked_on", "next_state", "clear", "preset", "enable", "data_in" };
+
+	std::string cache_key;
+	struct stat st;
+	if (!cache_file.empty() && stat(filename.c_str(), &st) == 0)
+		cache_key = stringf("/* yosys liberty cache v1: %s %lld %lld */", filename.c_str(),
+				(long long)st.st_size, (long long)st.st_mtime);
+
+	if (!cache_key.empty())
+	{
+		std::ifstream cache(cache_file.c_str());
+		std::string header;
+
+		if (std::getline(cache, header) && header == cache_key) {
+			std::string contents((std::istreambuf_iterator<char>(cache)), std::istreambuf_iterator<char>());
+			if (read_cache(contents)) {
+				log("Reading cached liberty data from `%s'.\n", cache_file.c_str());
+				return;
+			}
+			log_warning("Liberty cache file `%s' is corrupt, parsing `%s' again.\n", cache_file.c_str(), filename.c_str());
+		}
+	}
+
+	ast = parse();
+
+	if (!cache_key.empty() && ast != NULL)
+	{
+		// write to a temporary file first, so that an interrupted run never leaves a truncated cache file behind
+		std::string temp_file = make_temp_file(cache_file + ".XXXXXX");
+		std::ofstream cache(temp_file.c_str());
+
+		if (!cache.fail()) {
+			cache << cache_key << "\n";
+			write_cache_ast(cache, ast, "");
+			cache << cache_trailer;
+			cache.close();
+		}
+
+		if (cache.fail() || rename(temp_file.c_str(), cache_file.c_str()) != 0) {
+			log_warning("Can't write liberty cache file `%s': %s\n", cache_file.c_str(), strerror(errno));
+			remove(temp_file.c_str());
+		} else
+			log("Writing liberty cache file `%s'.\n", cache_file.c_str());
+	}
+}
+
+// parses the cache file contents after the header line, returns false if they are truncated or corrupt
+bool LibertyParser::read_cache(const std::string &contents)
+{
+	size_t trailer_len = strlen(cache_trailer);
+	if (contents.size() < trailer_len || contents.compare(contents.size() - trailer_len, trailer_len, cache_trailer) != 0)
+		return false;
+
+	std::istream *orig_f = f;
+	std::istringstream cache(contents);
+	f = &cache;
+	line = 2;
+	reading_cache = true;
+
+	try {
+		ast = parse();
+		// the library group must be followed by nothing but the trailer
+		int tok = lexer(NULL);
+		while (tok == ';')
+			tok = lexer(NULL);
+		if (ast == NULL || tok >= 0)
+			error();
+	} catch (LibertyCacheError) {
+		delete ast;
+		ast = NULL;
+	}
+
+	f = orig_f;
+	line = 1;
+	buffer_pos = buffer_end = 0;
+	buffer_eof = false;
+	reading_cache = false;
+	return ast != NULL;
+}
+
 void LibertyParser::error()
 {
+	if (reading_cache)
+		throw LibertyCacheError();
 	log_error("Syntax error in line %d.\n", line);
 }
 
@@ -41,13 +41,46 @@ namespace Yosys
 
 	struct LibertyParser
 	{
-		std::istream &f;
+		std::istream *f;
 		int line;
 		LibertyAst *ast;
-		LibertyParser(std::istream &f) : f(f), line(1), ast(parse()) {}
+
+		// when not empty, statements and groups with other ids are skipped without building AST nodes
+		std::set<std::string> keep_ids;
+
+		std::vector<char> buffer;
+		size_t buffer_pos, buffer_end;
+		bool buffer_eof;
+
+		// set while reading a cache file, error() then throws instead of aborting
+		bool reading_cache;
+
+		LibertyParser(std::istream &f);
+#ifndef FILTERLIB
+		// parses only the cell/pin/function subset used by read_liberty and dfflibmap,
+		// reusing or updating cache_file (if not empty) for the given liberty file
+		LibertyParser(std::istream &f, std::string filename, std::string cache_file);
+		bool read_cache(const std::string &contents);
+#endif
 		~LibertyParser() { if (ast) delete ast; }
-		int lexer(std::string &str);
+
+		bool fill_buffer();
+		int get_char() {
+			if (buffer_pos == buffer_end && !fill_buffer()) {
+				buffer_eof = true;
+				return EOF;
+			}
+			buffer_eof = false;
+			return (unsigned char)buffer[buffer_pos++];
+		}
+		void unget_char() {
+			if (!buffer_eof)
+				buffer_pos--;
+		}
+
+		int lexer(std::string *str);
 		LibertyAst *parse();
+		void skip_statement();
 		void error();
 	};
 }
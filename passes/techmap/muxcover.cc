@@ -33,6 +33,12 @@ struct MuxcoverWorker
 	Module *module;
 	SigMap sigmap;
 
+	struct mux_t
+	{
+		Cell *cell;
+		SigBit a, b, s;
+	};
+
 	struct newmux_t
 	{
 		int cost;
@@ -43,7 +49,7 @@ struct MuxcoverWorker
 	struct tree_t
 	{
 		SigBit root;
-		dict<SigBit, Cell*> muxes;
+		dict<SigBit, mux_t> muxes;
 		dict<SigBit, newmux_t> newmuxes;
 	};
 
@@ -71,7 +77,7 @@ struct MuxcoverWorker
 	{
 		pool<SigBit> roots;
 		pool<SigBit> used_once;
-		dict<SigBit, Cell*> sig_to_mux;
+		dict<SigBit, mux_t> sig_to_mux;
 
 		for (auto wire : module->wires()) {
 			if (!wire->port_output)
@@ -90,8 +96,13 @@ struct MuxcoverWorker
 					used_once.insert(bit);
 				}
 			}
-			if (cell->type == "$_MUX_")
-				sig_to_mux[sigmap(cell->getPort("\\Y"))] = cell;
+			if (cell->type == "$_MUX_") {
+				mux_t &mux = sig_to_mux[sigmap(cell->getPort("\\Y"))];
+				mux.cell = cell;
+				mux.a = sigmap(cell->getPort("\\A"));
+				mux.b = sigmap(cell->getPort("\\B"));
+				mux.s = sigmap(cell->getPort("\\S"));
+			}
 		}
 
 		log("  Treeifying %d MUXes:\n", GetSize(sig_to_mux));
@@ -108,10 +119,10 @@ struct MuxcoverWorker
 			while (!wavefront.empty()) {
 				SigBit bit = wavefront.pop();
 				if (sig_to_mux.count(bit) && (bit == rootsig || !roots.count(bit))) {
-					Cell *c = sig_to_mux.at(bit);
-					tree.muxes[bit] = c;
-					wavefront.insert(sigmap(c->getPort("\\A")));
-					wavefront.insert(sigmap(c->getPort("\\B")));
+					const mux_t &mux = sig_to_mux.at(bit);
+					tree.muxes[bit] = mux;
+					wavefront.insert(mux.a);
+					wavefront.insert(mux.b);
 				}
 			}
 
@@ -126,15 +137,15 @@ struct MuxcoverWorker
 
 	bool follow_muxtree(SigBit &ret_bit, tree_t &tree, SigBit bit, const char *path)
 	{
-		if (*path) {
-			if (tree.muxes.count(bit) == 0)
+		for (; *path; path++) {
+			auto it = tree.muxes.find(bit);
+			if (it == tree.muxes.end())
 				return false;
-			char port_name[3] = {'\\', *path, 0};
-			return follow_muxtree(ret_bit, tree, sigmap(tree.muxes.at(bit)->getPort(port_name)), path+1);
-		} else {
-			ret_bit = bit;
-			return true;
+			const mux_t &mux = it->second;
+			bit = *path == 'A' ? mux.a : *path == 'B' ? mux.b : mux.s;
 		}
+		ret_bit = bit;
+		return true;
 	}
 
 	int prepare_decode_mux(SigBit &A, SigBit B, SigBit sel, SigBit bit)
@@ -443,7 +454,7 @@ struct MuxcoverWorker
 
 	void implement_best_cover(tree_t &tree, SigBit bit, int count_muxes_by_type[4])
 	{
-		newmux_t mux = tree.newmuxes.at(bit);
+		const newmux_t &mux = tree.newmuxes.at(bit);
 
 		for (auto inbit : mux.inputs)
 			implement_best_cover(tree, inbit, count_muxes_by_type);
@@ -533,7 +544,7 @@ struct MuxcoverWorker
 		log("    Replaced tree at %s: %d MUX2, %d MUX4, %d MUX8, %d MUX16\n", log_signal(tree.root), 
 				count_muxes_by_type[0], count_muxes_by_type[1], count_muxes_by_type[2], count_muxes_by_type[3]);
 		for (auto &it : tree.muxes)
-			module->remove(it.second);
+			module->remove(it.second.cell);
 	}
 
 	void run()
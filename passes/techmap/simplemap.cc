@@ -33,11 +33,7 @@ void simplemap_not(RTLIL::Module *module, RTLIL::Cell *cell)
 
 	sig_a.extend_u0(GetSize(sig_y), cell->parameters.at("\\A_SIGNED").as_bool());
 
-	for (int i = 0; i < GetSize(sig_y); i++) {
-		RTLIL::Cell *gate = module->addCell(NEW_ID, "$_NOT_");
-		gate->setPort("\\A", sig_a[i]);
-		gate->setPort("\\Y", sig_y[i]);
-	}
+	module->addGates("$_NOT_", GetSize(sig_y), {{"\\A", sig_a}, {"\\Y", sig_y}}, NEW_ID_PREFIX);
 }
 
 void simplemap_pos(RTLIL::Module *module, RTLIL::Cell *cell)
@@ -63,11 +59,7 @@ void simplemap_bitop(RTLIL::Module *module, RTLIL::Cell *cell)
 	{
 		RTLIL::SigSpec sig_t = module->addWire(NEW_ID, GetSize(sig_y));
 
-		for (int i = 0; i < GetSize(sig_y); i++) {
-			RTLIL::Cell *gate = module->addCell(NEW_ID, "$_NOT_");
-			gate->setPort("\\A", sig_t[i]);
-			gate->setPort("\\Y", sig_y[i]);
-		}
+		module->addGates("$_NOT_", GetSize(sig_y), {{"\\A", sig_t}, {"\\Y", sig_y}}, NEW_ID_PREFIX);
 
 		sig_y = sig_t;
 	}
@@ -79,12 +71,7 @@ void simplemap_bitop(RTLIL::Module *module, RTLIL::Cell *cell)
 	if (cell->type == "$xnor") gate_type = "$_XOR_";
 	log_assert(!gate_type.empty());
 
-	for (int i = 0; i < GetSize(sig_y); i++) {
-		RTLIL::Cell *gate = module->addCell(NEW_ID, gate_type);
-		gate->setPort("\\A", sig_a[i]);
-		gate->setPort("\\B", sig_b[i]);
-		gate->setPort("\\Y", sig_y[i]);
-	}
+	module->addGates(gate_type, GetSize(sig_y), {{"\\A", sig_a}, {"\\B", sig_b}, {"\\Y", sig_y}}, NEW_ID_PREFIX);
 }
 
 void simplemap_reduce(RTLIL::Module *module, RTLIL::Cell *cell)
@@ -121,22 +108,21 @@ void simplemap_reduce(RTLIL::Module *module, RTLIL::Cell *cell)
 
 	while (sig_a.size() > 1)
 	{
-		RTLIL::SigSpec sig_t = module->addWire(NEW_ID, sig_a.size() / 2);
+		int pairs = sig_a.size() / 2;
+		RTLIL::SigSpec sig_t = module->addWire(NEW_ID, pairs);
+		RTLIL::SigSpec sig_l, sig_r;
 
-		for (int i = 0; i < sig_a.size(); i += 2)
-		{
-			if (i+1 == sig_a.size()) {
-				sig_t.append(sig_a[i]);
-				continue;
-			}
-
-			RTLIL::Cell *gate = module->addCell(NEW_ID, gate_type);
-			gate->setPort("\\A", sig_a[i]);
-			gate->setPort("\\B", sig_a[i+1]);
-			gate->setPort("\\Y", sig_t[i/2]);
-			last_output_cell = gate;
+		for (int i = 0; i < pairs; i++) {
+			sig_l.append(sig_a[2*i]);
+			sig_r.append(sig_a[2*i+1]);
 		}
 
+		std::vector<RTLIL::Cell*> gates = module->addGates(gate_type, pairs, {{"\\A", sig_l}, {"\\B", sig_r}, {"\\Y", sig_t}}, NEW_ID_PREFIX);
+		last_output_cell = gates.back();
+
+		if (sig_a.size() % 2)
+			sig_t.append(sig_a[sig_a.size()-1]);
+
 		sig_a = sig_t;
 	}
 
@@ -160,21 +146,20 @@ static void logic_reduce(RTLIL::Module *module, RTLIL::SigSpec &sig)
 {
 	while (sig.size() > 1)
 	{
-		RTLIL::SigSpec sig_t = module->addWire(NEW_ID, sig.size() / 2);
+		int pairs = sig.size() / 2;
+		RTLIL::SigSpec sig_t = module->addWire(NEW_ID, pairs);
+		RTLIL::SigSpec sig_l, sig_r;
 
-		for (int i = 0; i < sig.size(); i += 2)
-		{
-			if (i+1 == sig.size()) {
-				sig_t.append(sig[i]);
-				continue;
-			}
-
-			RTLIL::Cell *gate = module->addCell(NEW_ID, "$_OR_");
-			gate->setPort("\\A", sig[i]);
-			gate->setPort("\\B", sig[i+1]);
-			gate->setPort("\\Y", sig_t[i/2]);
+		for (int i = 0; i < pairs; i++) {
+			sig_l.append(sig[2*i]);
+			sig_r.append(sig[2*i+1]);
 		}
 
+		module->addGates("$_OR_", pairs, {{"\\A", sig_l}, {"\\B", sig_r}, {"\\Y", sig_t}}, NEW_ID_PREFIX);
+
+		if (sig.size() % 2)
+			sig_t.append(sig[sig.size()-1]);
+
 		sig = sig_t;
 	}
 
@@ -262,13 +247,7 @@ void simplemap_mux(RTLIL::Module *module, RTLIL::Cell *cell)
 	RTLIL::SigSpec sig_b = cell->getPort("\\B");
 	RTLIL::SigSpec sig_y = cell->getPort("\\Y");
 
-	for (int i = 0; i < GetSize(sig_y); i++) {
-		RTLIL::Cell *gate = module->addCell(NEW_ID, "$_MUX_");
-		gate->setPort("\\A", sig_a[i]);
-		gate->setPort("\\B", sig_b[i]);
-		gate->setPort("\\S", cell->getPort("\\S"));
-		gate->setPort("\\Y", sig_y[i]);
-	}
+	module->addGates("$_MUX_", GetSize(sig_y), {{"\\A", sig_a}, {"\\B", sig_b}, {"\\S", cell->getPort("\\S")}, {"\\Y", sig_y}}, NEW_ID_PREFIX);
 }
 
 void simplemap_slice(RTLIL::Module *module, RTLIL::Cell *cell)
@@ -299,12 +278,7 @@ void simplemap_sr(RTLIL::Module *module, RTLIL::Cell *cell)
 
 	std::string gate_type = stringf("$_SR_%c%c_", set_pol, clr_pol);
 
-	for (int i = 0; i < width; i++) {
-		RTLIL::Cell *gate = module->addCell(NEW_ID, gate_type);
-		gate->setPort("\\S", sig_s[i]);
-		gate->setPort("\\R", sig_r[i]);
-		gate->setPort("\\Q", sig_q[i]);
-	}
+	module->addGates(gate_type, width, {{"\\S", sig_s}, {"\\R", sig_r}, {"\\Q", sig_q}}, NEW_ID_PREFIX);
 }
 
 void simplemap_dff(RTLIL::Module *module, RTLIL::Cell *cell)
@@ -318,12 +292,7 @@ void simplemap_dff(RTLIL::Module *module, RTLIL::Cell *cell)
 
 	std::string gate_type = stringf("$_DFF_%c_", clk_pol);
 
-	for (int i = 0; i < width; i++) {
-		RTLIL::Cell *gate = module->addCell(NEW_ID, gate_type);
-		gate->setPort("\\C", sig_clk);
-		gate->setPort("\\D", sig_d[i]);
-		gate->setPort("\\Q", sig_q[i]);
-	}
+	module->addGates(gate_type, width, {{"\\C", sig_clk}, {"\\D", sig_d}, {"\\Q", sig_q}}, NEW_ID_PREFIX);
 }
 
 void simplemap_dffe(RTLIL::Module *module, RTLIL::Cell *cell)
@@ -339,13 +308,7 @@ void simplemap_dffe(RTLIL::Module *module, RTLIL::Cell *cell)
 
 	std::string gate_type = stringf("$_DFFE_%c%c_", clk_pol, en_pol);
 
-	for (int i = 0; i < width; i++) {
-		RTLIL::Cell *gate = module->addCell(NEW_ID, gate_type);
-		gate->setPort("\\C", sig_clk);
-		gate->setPort("\\E", sig_en);
-		gate->setPort("\\D", sig_d[i]);
-		gate->setPort("\\Q", sig_q[i]);
-	}
+	module->addGates(gate_type, width, {{"\\C", sig_clk}, {"\\E", sig_en}, {"\\D", sig_d}, {"\\Q", sig_q}}, NEW_ID_PREFIX);
 }
 
 void simplemap_dffsr(RTLIL::Module *module, RTLIL::Cell *cell)
@@ -363,14 +326,7 @@ void simplemap_dffsr(RTLIL::Module *module, RTLIL::Cell *cell)
 
 	std::string gate_type = stringf("$_DFFSR_%c%c%c_", clk_pol, set_pol, clr_pol);
 
-	for (int i = 0; i < width; i++) {
-		RTLIL::Cell *gate = module->addCell(NEW_ID, gate_type);
-		gate->setPort("\\C", sig_clk);
-		gate->setPort("\\S", sig_s[i]);
-		gate->setPort("\\R", sig_r[i]);
-		gate->setPort("\\D", sig_d[i]);
-		gate->setPort("\\Q", sig_q[i]);
-	}
+	module->addGates(gate_type, width, {{"\\C", sig_clk}, {"\\S", sig_s}, {"\\R", sig_r}, {"\\D", sig_d}, {"\\Q", sig_q}}, NEW_ID_PREFIX);
 }
 
 void simplemap_adff(RTLIL::Module *module, RTLIL::Cell *cell)
@@ -388,15 +344,14 @@ void simplemap_adff(RTLIL::Module *module, RTLIL::Cell *cell)
 	RTLIL::SigSpec sig_d = cell->getPort("\\D");
 	RTLIL::SigSpec sig_q = cell->getPort("\\Q");
 
-	std::string gate_type_0 = stringf("$_DFF_%c%c0_", clk_pol, rst_pol);
-	std::string gate_type_1 = stringf("$_DFF_%c%c1_", clk_pol, rst_pol);
+	// one addGates() call for each run of bits with the same reset value, so the gates are still created in bit order
+	for (int i = 0, j; i < width; i = j)
+	{
+		bool rst_one = rst_val.at(i) == RTLIL::State::S1;
+		for (j = i+1; j < width && (rst_val.at(j) == RTLIL::State::S1) == rst_one; j++) { }
 
-	for (int i = 0; i < width; i++) {
-		RTLIL::Cell *gate = module->addCell(NEW_ID, rst_val.at(i) == RTLIL::State::S1 ? gate_type_1 : gate_type_0);
-		gate->setPort("\\C", sig_clk);
-		gate->setPort("\\R", sig_rst);
-		gate->setPort("\\D", sig_d[i]);
-		gate->setPort("\\Q", sig_q[i]);
+		std::string gate_type = stringf("$_DFF_%c%c%c_", clk_pol, rst_pol, rst_one ? '1' : '0');
+		module->addGates(gate_type, j-i, {{"\\C", sig_clk}, {"\\R", sig_rst}, {"\\D", sig_d.extract(i, j-i)}, {"\\Q", sig_q.extract(i, j-i)}}, NEW_ID_PREFIX);
 	}
 }
 
@@ -411,12 +366,7 @@ void simplemap_dlatch(RTLIL::Module *module, RTLIL::Cell *cell)
 
 	std::string gate_type = stringf("$_DLATCH_%c_", en_pol);
 
-	for (int i = 0; i < width; i++) {
-		RTLIL::Cell *gate = module->addCell(NEW_ID, gate_type);
-		gate->setPort("\\E", sig_en);
-		gate->setPort("\\D", sig_d[i]);
-		gate->setPort("\\Q", sig_q[i]);
-	}
+	module->addGates(gate_type, width, {{"\\E", sig_en}, {"\\D", sig_d}, {"\\Q", sig_q}}, NEW_ID_PREFIX);
 }
 
 void simplemap_get_mappers(std::map<RTLIL::IdString, void(*)(RTLIL::Module*, RTLIL::Cell*)> &mappers)
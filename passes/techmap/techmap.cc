@@ -21,6 +21,7 @@
 #include "kernel/utils.h"
 #include "kernel/sigtools.h"
 #include "libs/sha1/sha1.h"
+#include "frontends/verilog/verilog_frontend.h"
 
 #include <stdlib.h>
 #include <stdio.h>
@@ -47,30 +48,27 @@ void apply_prefix(std::string prefix, std::string &id)
 		id = "$techmap" + prefix + "." + id;
 }
 
-void apply_prefix(std::string prefix, RTLIL::SigSpec &sig, RTLIL::Module *module)
+void apply_wire_map(RTLIL::SigSpec &sig, const dict<RTLIL::Wire*, RTLIL::Wire*> &wire_map)
 {
 	std::vector<RTLIL::SigChunk> chunks = sig;
 	for (auto &chunk : chunks)
-		if (chunk.wire != NULL) {
-			std::string wire_name = chunk.wire->name.str();
-			apply_prefix(prefix, wire_name);
-			log_assert(module->wires_.count(wire_name) > 0);
-			chunk.wire = module->wires_[wire_name];
-		}
+		if (chunk.wire != NULL)
+			chunk.wire = wire_map.at(chunk.wire);
 	sig = chunks;
 }
 
 struct TechmapWorker
 {
 	std::map<RTLIL::IdString, void(*)(RTLIL::Module*, RTLIL::Cell*)> simplemap_mappers;
-	std::map<std::pair<RTLIL::IdString, std::map<RTLIL::IdString, RTLIL::Const>>, RTLIL::Module*> techmap_cache;
-	std::map<RTLIL::Module*, bool> techmap_do_cache;
+	dict<std::pair<RTLIL::IdString, std::vector<std::pair<RTLIL::IdString, RTLIL::Const>>>, RTLIL::Module*> techmap_cache;
+	dict<RTLIL::Module*, bool> techmap_do_cache;
 	std::set<RTLIL::Module*, RTLIL::IdString::compare_ptr_by_name<RTLIL::Module>> module_queue;
 	dict<Module*, SigMap> sigmaps;
 
 	pool<IdString> flatten_do_list;
 	pool<IdString> flatten_done_list;
 	pool<Cell*> flatten_keep_list;
+	pool<IdString> flatten_large_modules;
 
 	struct TechmapWireData {
 		RTLIL::Wire *wire;
@@ -79,6 +77,20 @@ struct TechmapWorker
 
 	typedef std::map<std::string, std::vector<TechmapWireData>> TechmapWires;
 
+	// how a cell is mapped. techmap_module() first determines this for all cells of
+	// a module, deriving and preparing all templates it needs, and then replaces the
+	// cells using the finished templates, which are not modified anymore.
+	struct TechmapCellTask {
+		RTLIL::Cell *cell;
+		RTLIL::IdString cell_type;
+		// simplemap or maccmap: call the mapper on the cell (tpl == nullptr),
+		// or change the cell type to the $extern module in tpl
+		std::string extmapper_name;
+		// the template, or the $extern module the cell is changed to (extern_import)
+		RTLIL::Module *tpl;
+		bool extern_import;
+	};
+
 	bool extern_mode;
 	bool assert_mode;
 	bool flatten_mode;
@@ -158,16 +170,7 @@ struct TechmapWorker
 
 	void techmap_module_worker(RTLIL::Design *design, RTLIL::Module *module, RTLIL::Cell *cell, RTLIL::Module *tpl)
 	{
-		if (tpl->processes.size() != 0) {
-			log("Technology map yielded processes:\n");
-			for (auto &it : tpl->processes)
-				log("  %s",RTLIL::id2cstr(it.first));
-			if (autoproc_mode) {
-				Pass::call_on_module(tpl->design, tpl, "proc");
-				log_assert(GetSize(tpl->processes) == 0);
-			} else
-				log_error("Technology map yielded processes -> this is not supported (use -autoproc to run 'proc' automatically).\n");
-		}
+		log_assert(tpl->processes.size() == 0);
 
 		std::string orig_cell_name;
 		if (!flatten_mode)
@@ -178,11 +181,15 @@ struct TechmapWorker
 					break;
 				}
 
+		// the template wires are mapped to their copies by pointer, so that the
+		// prefixed names only need to be created once per wire and instance
+		std::string prefix = cell->name.str();
+		dict<RTLIL::Wire*, RTLIL::Wire*> wire_map;
 		dict<IdString, IdString> memory_renames;
 
 		for (auto &it : tpl->memories) {
 			std::string m_name = it.first.str();
-			apply_prefix(cell->name.str(), m_name);
+			apply_prefix(prefix, m_name);
 			RTLIL::Memory *m = new RTLIL::Memory;
 			m->name = m_name;
 			m->width = it.second->width;
@@ -200,8 +207,9 @@ struct TechmapWorker
 			if (it.second->port_id > 0)
 				positional_ports[stringf("$%d", it.second->port_id)] = it.first;
 			std::string w_name = it.second->name.str();
-			apply_prefix(cell->name.str(), w_name);
+			apply_prefix(prefix, w_name);
 			RTLIL::Wire *w = module->addWire(w_name, it.second);
+			wire_map[it.second] = w;
 			w->port_input = false;
 			w->port_output = false;
 			w->port_id = 0;
@@ -225,12 +233,10 @@ struct TechmapWorker
 			RTLIL::SigSig c;
 			if (w->port_output) {
 				c.first = it.second;
-				c.second = RTLIL::SigSpec(w);
-				apply_prefix(cell->name.str(), c.second, module);
+				c.second = RTLIL::SigSpec(wire_map.at(w));
 			} else {
-				c.first = RTLIL::SigSpec(w);
+				c.first = RTLIL::SigSpec(wire_map.at(w));
 				c.second = it.second;
-				apply_prefix(cell->name.str(), c.first, module);
 			}
 			if (c.second.size() > c.first.size())
 				c.second.remove(c.first.size(), c.second.size() - c.first.size());
@@ -263,7 +269,7 @@ struct TechmapWorker
 			if (!flatten_mode && c_name == "\\_TECHMAP_REPLACE_")
 				c_name = orig_cell_name;
 			else
-				apply_prefix(cell->name.str(), c_name);
+				apply_prefix(prefix, c_name);
 
 			RTLIL::Cell *c = module->addCell(c_name, it.second);
 			design->select(module, c);
@@ -272,7 +278,7 @@ struct TechmapWorker
 				c->type = c->type.substr(1);
 
 			for (auto &it2 : c->connections_) {
-				apply_prefix(cell->name.str(), it2.second, module);
+				apply_wire_map(it2.second, wire_map);
 				port_signal_map.apply(it2.second);
 			}
 
@@ -285,8 +291,8 @@ struct TechmapWorker
 
 		for (auto &it : tpl->connections()) {
 			RTLIL::SigSig c = it;
-			apply_prefix(cell->name.str(), c.first, module);
-			apply_prefix(cell->name.str(), c.second, module);
+			apply_wire_map(c.first, wire_map);
+			apply_wire_map(c.second, wire_map);
 			port_signal_map.apply(c.first);
 			port_signal_map.apply(c.second);
 			module->connect(c);
@@ -295,7 +301,7 @@ struct TechmapWorker
 		module->remove(cell);
 	}
 
-	bool techmap_module(RTLIL::Design *design, RTLIL::Module *module, RTLIL::Design *map, std::set<RTLIL::Cell*> &handled_cells,
+	bool techmap_module(RTLIL::Design *design, RTLIL::Module *module, RTLIL::Design *map, pool<RTLIL::Cell*, hash_ptr_ops> &handled_cells,
 			const std::map<RTLIL::IdString, std::set<RTLIL::IdString, RTLIL::sort_by_id_str>> &celltypeMap, bool in_recursion)
 	{
 		std::string mapmsg_prefix = in_recursion ? "Recursively mapping" : "Mapping";
@@ -308,9 +314,7 @@ struct TechmapWorker
 
 		SigMap sigmap(module);
 
-		TopoSort<RTLIL::Cell*, RTLIL::IdString::compare_ptr_by_name<RTLIL::Cell>> cells;
-		std::map<RTLIL::Cell*, std::set<RTLIL::SigBit>> cell_to_inbit;
-		std::map<RTLIL::SigBit, std::set<RTLIL::Cell*>> outbit_to_cell;
+		std::vector<RTLIL::Cell*> cells;
 
 		for (auto cell : module->cells())
 		{
@@ -332,9 +336,13 @@ struct TechmapWorker
 				for (auto &tpl_name : celltypeMap.at(cell_type))
 					if (map->modules_[tpl_name]->get_bool_attribute("\\keep_hierarchy"))
 						keepit = true;
-				if (keepit) {
+				bool too_large = !keepit && flatten_large_modules.count(cell_type) > 0;
+				if (keepit || too_large) {
 					if (!flatten_keep_list[cell]) {
-						log("Keeping %s.%s (found keep_hierarchy property).\n", log_id(module), log_id(cell));
+						if (too_large)
+							log("Keeping %s.%s (module is larger than the -max_cells limit).\n", log_id(module), log_id(cell));
+						else
+							log("Keeping %s.%s (found keep_hierarchy property).\n", log_id(module), log_id(cell));
 						flatten_keep_list.insert(cell);
 					}
 					if (!flatten_done_list[cell->type])
@@ -343,6 +351,26 @@ struct TechmapWorker
 				}
 			}
 
+			cells.push_back(cell);
+		}
+
+		// sort the cells topologically (visiting the cells and their drivers
+		// in the order of their names), using index-based adjacency lists
+
+		std::sort(cells.begin(), cells.end(), RTLIL::IdString::compare_ptr_by_name<RTLIL::Cell>());
+
+		std::vector<std::vector<int>> cell_to_inbit_drivers(GetSize(cells));
+		std::vector<std::vector<RTLIL::SigBit>> cell_to_inbit(GetSize(cells));
+		dict<RTLIL::SigBit, std::vector<int>> outbit_to_cell;
+
+		for (int i = 0; i < GetSize(cells); i++)
+		{
+			RTLIL::Cell *cell = cells[i];
+
+			std::string cell_type = cell->type.str();
+			if (in_recursion && cell_type.substr(0, 2) == "\\$")
+				cell_type = cell_type.substr(1);
+
 			for (auto &conn : cell->connections())
 			{
 				RTLIL::SigSpec sig = sigmap(conn.second);
@@ -351,28 +379,76 @@ struct TechmapWorker
 				if (GetSize(sig) == 0)
 					continue;
 
+				bool is_input = false, is_output = false;
 				for (auto &tpl_name : celltypeMap.at(cell_type)) {
 					RTLIL::Module *tpl = map->modules_[tpl_name];
 					RTLIL::Wire *port = tpl->wire(conn.first);
 					if (port && port->port_input)
-						cell_to_inbit[cell].insert(sig.begin(), sig.end());
+						is_input = true;
 					if (port && port->port_output)
-						for (auto &bit : sig)
-							outbit_to_cell[bit].insert(cell);
+						is_output = true;
 				}
+
+				if (is_input)
+					cell_to_inbit[i].insert(cell_to_inbit[i].end(), sig.begin(), sig.end());
+				if (is_output)
+					for (auto &bit : sig) {
+						std::vector<int> &drivers = outbit_to_cell[bit];
+						if (drivers.empty() || drivers.back() != i)
+							drivers.push_back(i);
+					}
 			}
+		}
 
-			cells.node(cell);
+		for (int i = 0; i < GetSize(cells); i++) {
+			std::vector<int> &drivers = cell_to_inbit_drivers[i];
+			for (auto &bit : cell_to_inbit[i]) {
+				auto it = outbit_to_cell.find(bit);
+				if (it != outbit_to_cell.end())
+					drivers.insert(drivers.end(), it->second.begin(), it->second.end());
+			}
+			std::sort(drivers.begin(), drivers.end());
+			drivers.erase(std::unique(drivers.begin(), drivers.end()), drivers.end());
 		}
 
-		for (auto &it_right : cell_to_inbit)
-		for (auto &it_sigbit : it_right.second)
-		for (auto &it_left : outbit_to_cell[it_sigbit])
-			cells.edge(it_left, it_right.first);
+		std::vector<RTLIL::Cell*> sorted_cells;
+		std::vector<bool> marked_cells(GetSize(cells)), active_cells(GetSize(cells));
+		std::vector<std::pair<int, int>> active_stack;
+
+		for (int root = 0; root < GetSize(cells); root++)
+		{
+			if (marked_cells[root])
+				continue;
 
-		cells.sort();
+			active_cells[root] = true;
+			active_stack.push_back(std::pair<int, int>(root, 0));
+
+			while (!active_stack.empty())
+			{
+				int n = active_stack.back().first;
+				int &next_driver = active_stack.back().second;
+
+				if (next_driver < GetSize(cell_to_inbit_drivers[n])) {
+					int driver = cell_to_inbit_drivers[n][next_driver++];
+					if (!active_cells[driver] && !marked_cells[driver]) {
+						active_cells[driver] = true;
+						active_stack.push_back(std::pair<int, int>(driver, 0));
+					}
+					continue;
+				}
 
-		for (auto cell : cells.sorted)
+				active_cells[n] = false;
+				marked_cells[n] = true;
+				sorted_cells.push_back(cells[n]);
+				active_stack.pop_back();
+			}
+		}
+
+		// first determine the template for each cell, deriving the templates as needed
+
+		std::vector<TechmapCellTask> tasks;
+
+		for (auto cell : sorted_cells)
 		{
 			log_assert(handled_cells.count(cell) == 0);
 			log_assert(cell == module->cell(cell->name));
@@ -382,6 +458,12 @@ struct TechmapWorker
 			if (in_recursion && cell_type.substr(0, 2) == "\\$")
 				cell_type = cell_type.substr(1);
 
+			TechmapCellTask task;
+			task.cell = cell;
+			task.cell_type = cell_type;
+			task.tpl = nullptr;
+			task.extern_import = false;
+
 			for (auto &tpl_name : celltypeMap.at(cell_type))
 			{
 				RTLIL::IdString derived_name = tpl_name;
@@ -406,11 +488,9 @@ struct TechmapWorker
 
 					if (!extmapper_name.empty())
 					{
-						cell->type = cell_type;
-
 						if ((extern_mode && !in_recursion) || extmapper_name == "wrap")
 						{
-							std::string m_name = stringf("$extern:%s:%s", extmapper_name.c_str(), log_id(cell->type));
+							std::string m_name = stringf("$extern:%s:%s", extmapper_name.c_str(), log_id(cell_type));
 
 							for (auto &c : cell->parameters)
 								m_name += stringf(":%s=%s", log_id(c.first), log_signal(c.second));
@@ -424,7 +504,8 @@ struct TechmapWorker
 							if (extmapper_module == nullptr)
 							{
 								extmapper_module = extmapper_design->addModule(m_name);
-								RTLIL::Cell *extmapper_cell = extmapper_module->addCell(cell->type, cell);
+								RTLIL::Cell *extmapper_cell = extmapper_module->addCell(cell_type, cell);
+								extmapper_cell->type = cell_type;
 
 								int port_counter = 1;
 								for (auto &c : extmapper_cell->connections_) {
@@ -464,36 +545,16 @@ struct TechmapWorker
 								}
 							}
 
-							cell->type = extmapper_module->name;
-							cell->parameters.clear();
-
 							if (!extern_mode || in_recursion) {
 								tpl = extmapper_module;
 								goto use_wrapper_tpl;
 							}
 
-							log("%s %s.%s (%s) to %s.\n", mapmsg_prefix.c_str(), log_id(module), log_id(cell), log_id(cell->type), log_id(extmapper_module));
-						}
-						else
-						{
-							log("%s %s.%s (%s) with %s.\n", mapmsg_prefix.c_str(), log_id(module), log_id(cell), log_id(cell->type), extmapper_name.c_str());
-
-							if (extmapper_name == "simplemap") {
-								if (simplemap_mappers.count(cell->type) == 0)
-									log_error("No simplemap mapper for cell type %s found!\n", RTLIL::id2cstr(cell->type));
-								simplemap_mappers.at(cell->type)(module, cell);
-							}
-
-							if (extmapper_name == "maccmap") {
-								if (cell->type != "$macc")
-									log_error("The maccmap mapper can only map $macc (not %s) cells!\n", log_id(cell->type));
-								maccmap(module, cell);
-							}
-
-							module->remove(cell);
-							cell = NULL;
+							task.tpl = extmapper_module;
 						}
 
+						task.extmapper_name = extmapper_name;
+						tasks.push_back(task);
 						did_something = true;
 						mapped_cell = true;
 						break;
@@ -569,9 +630,11 @@ struct TechmapWorker
 			use_wrapper_tpl:;
 					// do not register techmap_wrap modules with techmap_cache
 				} else {
-					std::pair<RTLIL::IdString, std::map<RTLIL::IdString, RTLIL::Const>> key(tpl_name, parameters);
-					if (techmap_cache.count(key) > 0) {
-						tpl = techmap_cache[key];
+					std::pair<RTLIL::IdString, std::vector<std::pair<RTLIL::IdString, RTLIL::Const>>> key(tpl_name,
+							std::vector<std::pair<RTLIL::IdString, RTLIL::Const>>(parameters.begin(), parameters.end()));
+					auto cache_it = techmap_cache.find(key);
+					if (cache_it != techmap_cache.end()) {
+						tpl = cache_it->second;
 					} else {
 						if (cell->parameters.size() != 0) {
 							derived_name = tpl->derive(map, dict<RTLIL::IdString, RTLIL::Const>(parameters.begin(), parameters.end()));
@@ -759,10 +822,11 @@ struct TechmapWorker
 				if (extern_mode && !in_recursion)
 				{
 					std::string m_name = stringf("$extern:%s", log_id(tpl));
+					RTLIL::Module *m = design->module(m_name);
 
-					if (!design->module(m_name))
+					if (m == nullptr)
 					{
-						RTLIL::Module *m = design->addModule(m_name);
+						m = design->addModule(m_name);
 						tpl->cloneInto(m);
 
 						for (auto cell : m->cells()) {
@@ -773,16 +837,25 @@ struct TechmapWorker
 						module_queue.insert(m);
 					}
 
-					log("%s %s.%s to imported %s.\n", mapmsg_prefix.c_str(), log_id(module), log_id(cell), log_id(m_name));
-					cell->type = m_name;
-					cell->parameters.clear();
+					task.tpl = m;
+					task.extern_import = true;
 				}
 				else
 				{
-					log("%s %s.%s using %s.\n", mapmsg_prefix.c_str(), log_id(module), log_id(cell), log_id(tpl));
-					techmap_module_worker(design, module, cell, tpl);
-					cell = NULL;
+					if (tpl->processes.size() != 0) {
+						log("Technology map yielded processes:\n");
+						for (auto &it : tpl->processes)
+							log("  %s",RTLIL::id2cstr(it.first));
+						if (autoproc_mode) {
+							Pass::call_on_module(tpl->design, tpl, "proc");
+							log_assert(GetSize(tpl->processes) == 0);
+						} else
+							log_error("Technology map yielded processes -> this is not supported (use -autoproc to run 'proc' automatically).\n");
+					}
+
+					task.tpl = tpl;
 				}
+				tasks.push_back(task);
 				did_something = true;
 				mapped_cell = true;
 				break;
@@ -791,7 +864,8 @@ struct TechmapWorker
 			if (assert_mode && !mapped_cell)
 				log_error("(ASSERT MODE) Failed to map cell %s.%s (%s).\n", log_id(module), log_id(cell), log_id(cell->type));
 
-			handled_cells.insert(cell);
+			if (!mapped_cell)
+				handled_cells.insert(cell);
 		}
 
 		if (log_continue) {
@@ -799,12 +873,123 @@ struct TechmapWorker
 			log_continue = false;
 		}
 
+		// then replace the cells, the templates are only read from here on
+
+		for (auto &task : tasks)
+		{
+			RTLIL::Cell *cell = task.cell;
+
+			if (!task.extmapper_name.empty() && task.tpl == nullptr)
+			{
+				cell->type = task.cell_type;
+				log("%s %s.%s (%s) with %s.\n", mapmsg_prefix.c_str(), log_id(module), log_id(cell), log_id(cell->type), task.extmapper_name.c_str());
+
+				if (task.extmapper_name == "simplemap") {
+					if (simplemap_mappers.count(cell->type) == 0)
+						log_error("No simplemap mapper for cell type %s found!\n", RTLIL::id2cstr(cell->type));
+					simplemap_mappers.at(cell->type)(module, cell);
+				}
+
+				if (task.extmapper_name == "maccmap") {
+					if (cell->type != "$macc")
+						log_error("The maccmap mapper can only map $macc (not %s) cells!\n", log_id(cell->type));
+					maccmap(module, cell);
+				}
+
+				module->remove(cell);
+			}
+			else if (!task.extmapper_name.empty() || task.extern_import)
+			{
+				cell->type = task.tpl->name;
+				cell->parameters.clear();
+
+				if (task.extern_import)
+					log("%s %s.%s to imported %s.\n", mapmsg_prefix.c_str(), log_id(module), log_id(cell), log_id(task.tpl));
+				else
+					log("%s %s.%s (%s) to %s.\n", mapmsg_prefix.c_str(), log_id(module), log_id(cell), log_id(cell->type), log_id(task.tpl));
+
+				handled_cells.insert(cell);
+			}
+			else
+			{
+				log("%s %s.%s using %s.\n", mapmsg_prefix.c_str(), log_id(module), log_id(cell), log_id(task.tpl));
+				techmap_module_worker(design, module, cell, task.tpl);
+			}
+		}
+
 		return did_something;
 	}
 };
 
 struct TechmapPass : public Pass {
+	// parsed map files, indexed by frontend command and file name. the cached
+	// designs are never modified, each techmap call works on clones.
+	struct map_cache_entry_t {
+		// the verilog_defaults used when parsing the file
+		std::vector<std::string> defaults;
+		// sha1 of the map file and of each file included by it
+		dict<std::string, std::string> file_hashes;
+		RTLIL::Design *design;
+	};
+	dict<std::string, map_cache_entry_t> map_cache;
+
 	TechmapPass() : Pass("techmap", "generic technology mapper") { }
+	virtual ~TechmapPass() {
+		for (auto &it : map_cache)
+			delete it.second.design;
+		map_cache.clear();
+	}
+	static std::string file_hash(std::string filename)
+	{
+		std::ifstream f(filename.c_str());
+		if (f.fail())
+			return std::string();
+		std::string contents((std::istreambuf_iterator<char>(f)), std::istreambuf_iterator<char>());
+		return sha1(contents);
+	}
+	RTLIL::Design *get_map_design(std::string filename, std::string frontend)
+	{
+		std::string key = frontend + " " + filename;
+		auto it = map_cache.find(key);
+		if (it != map_cache.end()) {
+			bool up_to_date = it->second.defaults == verilog_defaults;
+			for (auto &file_it : it->second.file_hashes)
+				if (up_to_date && file_hash(file_it.first) != file_it.second)
+					up_to_date = false;
+			if (up_to_date) {
+				log("Using cached map file `%s'.\n", filename.c_str());
+				return it->second.design;
+			}
+			delete it->second.design;
+			map_cache.erase(it);
+		}
+
+		map_cache_entry_t entry;
+		entry.defaults = verilog_defaults;
+		entry.design = new RTLIL::Design;
+		verilog_include_files.clear();
+
+		if (filename == "<techmap.v>") {
+			std::istringstream f(stdcells_code);
+			Frontend::frontend_call(entry.design, &f, filename, frontend);
+		} else {
+			entry.file_hashes[filename] = file_hash(filename);
+			std::ifstream f;
+			f.open(filename.c_str());
+			if (f.fail()) {
+				delete entry.design;
+				log_cmd_error("Can't open map file `%s'\n", filename.c_str());
+			}
+			Frontend::frontend_call(entry.design, &f, filename, frontend);
+		}
+
+		for (auto &fn : verilog_include_files)
+			entry.file_hashes[fn] = file_hash(fn);
+		verilog_include_files.clear();
+
+		map_cache[key] = entry;
+		return entry.design;
+	}
 	virtual void help()
 	{
 		//   |---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|
@@ -824,6 +1009,10 @@ struct TechmapPass : public Pass {
 		log("    -map %%<design-name>\n");
 		log("        like -map above, but with an in-memory design instead of a file.\n");
 		log("\n");
+		log("Map files are only parsed once. Later techmap calls with the same map file\n");
+		log("and -D/-I options reuse the parsed file until the contents of the file or of\n");
+		log("a file included by it, or the options set with verilog_defaults change.\n");
+		log("\n");
 		log("    -extern\n");
 		log("        load the cell implementations as separate modules into the design\n");
 		log("        instead of inlining them.\n");
@@ -986,28 +1175,27 @@ struct TechmapPass : public Pass {
 		}
 		extra_args(args, argidx, design);
 
+		if (map_files.empty())
+			map_files.push_back("<techmap.v>");
+
 		RTLIL::Design *map = new RTLIL::Design;
-		if (map_files.empty()) {
-			std::istringstream f(stdcells_code);
-			Frontend::frontend_call(map, &f, "<techmap.v>", verilog_frontend);
-		} else
-			for (auto &fn : map_files)
-				if (fn.substr(0, 1) == "%") {
-					if (!saved_designs.count(fn.substr(1))) {
-						delete map;
-						log_cmd_error("Can't saved design `%s'.\n", fn.c_str()+1);
-					}
-					for (auto mod : saved_designs.at(fn.substr(1))->modules())
-						if (!map->has(mod->name))
-							map->add(mod->clone());
-				} else {
-					std::ifstream f;
-					rewrite_filename(fn);
-					f.open(fn.c_str());
-					if (f.fail())
-						log_cmd_error("Can't open map file `%s'\n", fn.c_str());
-					Frontend::frontend_call(map, &f, fn, (fn.size() > 3 && fn.substr(fn.size()-3) == ".il") ? "ilang" : verilog_frontend);
+		for (auto &fn : map_files)
+			if (fn.substr(0, 1) == "%") {
+				if (!saved_designs.count(fn.substr(1))) {
+					delete map;
+					log_cmd_error("Can't saved design `%s'.\n", fn.c_str()+1);
 				}
+				for (auto mod : saved_designs.at(fn.substr(1))->modules())
+					if (!map->has(mod->name))
+						map->add(mod->clone());
+			} else {
+				if (fn != "<techmap.v>")
+					rewrite_filename(fn);
+				RTLIL::Design *map_design = get_map_design(fn, (fn.size() > 3 && fn.substr(fn.size()-3) == ".il") ? "ilang" : verilog_frontend);
+				for (auto mod : map_design->modules())
+					if (!map->has(mod->name))
+						map->add(mod->clone());
+			}
 
 		std::map<RTLIL::IdString, std::set<RTLIL::IdString, RTLIL::sort_by_id_str>> celltypeMap;
 		for (auto &it : map->modules_) {
@@ -1033,7 +1221,7 @@ struct TechmapPass : public Pass {
 			worker.module_queue.erase(module);
 
 			bool did_something = true;
-			std::set<RTLIL::Cell*> handled_cells;
+			pool<RTLIL::Cell*, hash_ptr_ops> handled_cells;
 			while (did_something) {
 				did_something = false;
 					if (worker.techmap_module(design, module, map, handled_cells, celltypeMap, false))
@@ -1052,13 +1240,37 @@ struct TechmapPass : public Pass {
 	}
 } TechmapPass;
  
+// number of cells in the module after flattening everything that is not kept because of keep_hierarchy or max_cells
+int64_t flattened_size(RTLIL::Design *design, RTLIL::Module *module, int64_t max_cells, dict<RTLIL::IdString, int64_t> &cache)
+{
+	if (cache.count(module->name))
+		return cache.at(module->name);
+
+	// guard against recursive hierarchies
+	cache[module->name] = 0;
+
+	int64_t size = 0;
+	for (auto cell : module->cells()) {
+		RTLIL::Module *submod = design->module(cell->type);
+		if (submod == nullptr || submod->get_bool_attribute("\\blackbox") || submod->get_bool_attribute("\\keep_hierarchy") ||
+				cell->get_bool_attribute("\\keep_hierarchy")) {
+			size++;
+			continue;
+		}
+		int64_t subsize = flattened_size(design, submod, max_cells, cache);
+		size += subsize > max_cells ? 1 : subsize;
+	}
+
+	return cache[module->name] = size;
+}
+
 struct FlattenPass : public Pass {
 	FlattenPass() : Pass("flatten", "flatten design") { }
 	virtual void help()
 	{
 		//   |---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|---v---|
 		log("\n");
-		log("    flatten [selection]\n");
+		log("    flatten [options] [selection]\n");
 		log("\n");
 		log("This pass flattens the design by replacing cells by their implementation. This\n");
 		log("pass is very simmilar to the 'techmap' pass. The only difference is that this\n");
@@ -1067,17 +1279,39 @@ struct FlattenPass : public Pass {
 		log("Cells and/or modules with the 'keep_hiearchy' attribute set will not be\n");
 		log("flattened by this command.\n");
 		log("\n");
+		log("    -max_cells <N>\n");
+		log("        only flatten instances of modules that have at most N cells after\n");
+		log("        flattening. larger modules are kept like modules with the\n");
+		log("        'keep_hierarchy' attribute, i.e. they are only flattened internally.\n");
+		log("\n");
 	}
 	virtual void execute(std::vector<std::string> args, RTLIL::Design *design)
 	{
 		log_header("Executing FLATTEN pass (flatten design).\n");
 		log_push();
 
-		extra_args(args, 1, design);
+		int64_t max_cells = -1;
+
+		size_t argidx;
+		for (argidx = 1; argidx < args.size(); argidx++) {
+			if (args[argidx] == "-max_cells" && argidx+1 < args.size()) {
+				max_cells = atoll(args[++argidx].c_str());
+				continue;
+			}
+			break;
+		}
+		extra_args(args, argidx, design);
 
 		TechmapWorker worker;
 		worker.flatten_mode = true;
 
+		if (max_cells >= 0) {
+			dict<RTLIL::IdString, int64_t> size_cache;
+			for (auto mod : design->modules())
+				if (flattened_size(design, mod, max_cells, size_cache) > max_cells)
+					worker.flatten_large_modules.insert(mod->name);
+		}
+
 		std::map<RTLIL::IdString, std::set<RTLIL::IdString, RTLIL::sort_by_id_str>> celltypeMap;
 		for (auto module : design->modules())
 			celltypeMap[module->name].insert(module->name);
@@ -1088,7 +1322,7 @@ struct FlattenPass : public Pass {
 				if (mod->get_bool_attribute("\\top"))
 					top_mod = mod;
 
-		std::set<RTLIL::Cell*> handled_cells;
+		pool<RTLIL::Cell*, hash_ptr_ops> handled_cells;
 		if (top_mod != NULL) {
 			worker.flatten_do_list.insert(top_mod->name);
 			while (!worker.flatten_do_list.empty()) {
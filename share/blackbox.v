@@ -0,0 +1,856 @@
+module \$not (A, Y);
+parameter A_SIGNED = 0;
+parameter A_WIDTH = 0;
+parameter Y_WIDTH = 0;
+input [A_WIDTH-1:0] A;
+output [Y_WIDTH-1:0] Y;
+endmodule
+
+module \$pos (A, Y);
+parameter A_SIGNED = 0;
+parameter A_WIDTH = 0;
+parameter Y_WIDTH = 0;
+input [A_WIDTH-1:0] A;
+output [Y_WIDTH-1:0] Y;
+endmodule
+
+module \$neg (A, Y);
+parameter A_SIGNED = 0;
+parameter A_WIDTH = 0;
+parameter Y_WIDTH = 0;
+input [A_WIDTH-1:0] A;
+output [Y_WIDTH-1:0] Y;
+endmodule
+
+module \$and (A, B, Y);
+parameter A_SIGNED = 0;
+parameter B_SIGNED = 0;
+parameter A_WIDTH = 0;
+parameter B_WIDTH = 0;
+parameter Y_WIDTH = 0;
+input [A_WIDTH-1:0] A;
+input [B_WIDTH-1:0] B;
+output [Y_WIDTH-1:0] Y;
+endmodule
+
+module \$or (A, B, Y);
+parameter A_SIGNED = 0;
+parameter B_SIGNED = 0;
+parameter A_WIDTH = 0;
+parameter B_WIDTH = 0;
+parameter Y_WIDTH = 0;
+input [A_WIDTH-1:0] A;
+input [B_WIDTH-1:0] B;
+output [Y_WIDTH-1:0] Y;
+endmodule
+
+module \$xor (A, B, Y);
+parameter A_SIGNED = 0;
+parameter B_SIGNED = 0;
+parameter A_WIDTH = 0;
+parameter B_WIDTH = 0;
+parameter Y_WIDTH = 0;
+input [A_WIDTH-1:0] A;
+input [B_WIDTH-1:0] B;
+output [Y_WIDTH-1:0] Y;
+endmodule
+
+module \$xnor (A, B, Y);
+parameter A_SIGNED = 0;
+parameter B_SIGNED = 0;
+parameter A_WIDTH = 0;
+parameter B_WIDTH = 0;
+parameter Y_WIDTH = 0;
+input [A_WIDTH-1:0] A;
+input [B_WIDTH-1:0] B;
+output [Y_WIDTH-1:0] Y;
+endmodule
+
+module \$reduce_and (A, Y);
+parameter A_SIGNED = 0;
+parameter A_WIDTH = 0;
+parameter Y_WIDTH = 0;
+input [A_WIDTH-1:0] A;
+output [Y_WIDTH-1:0] Y;
+endmodule
+
+module \$reduce_or (A, Y);
+parameter A_SIGNED = 0;
+parameter A_WIDTH = 0;
+parameter Y_WIDTH = 0;
+input [A_WIDTH-1:0] A;
+output [Y_WIDTH-1:0] Y;
+endmodule
+
+module \$reduce_xor (A, Y);
+parameter A_SIGNED = 0;
+parameter A_WIDTH = 0;
+parameter Y_WIDTH = 0;
+input [A_WIDTH-1:0] A;
+output [Y_WIDTH-1:0] Y;
+endmodule
+
+module \$reduce_xnor (A, Y);
+parameter A_SIGNED = 0;
+parameter A_WIDTH = 0;
+parameter Y_WIDTH = 0;
+input [A_WIDTH-1:0] A;
+output [Y_WIDTH-1:0] Y;
+endmodule
+
+module \$reduce_bool (A, Y);
+parameter A_SIGNED = 0;
+parameter A_WIDTH = 0;
+parameter Y_WIDTH = 0;
+input [A_WIDTH-1:0] A;
+output [Y_WIDTH-1:0] Y;
+endmodule
+
+module \$shl (A, B, Y);
+parameter A_SIGNED = 0;
+parameter B_SIGNED = 0;
+parameter A_WIDTH = 0;
+parameter B_WIDTH = 0;
+parameter Y_WIDTH = 0;
+input [A_WIDTH-1:0] A;
+input [B_WIDTH-1:0] B;
+output [Y_WIDTH-1:0] Y;
+endmodule
+
+module \$shr (A, B, Y);
+parameter A_SIGNED = 0;
+parameter B_SIGNED = 0;
+parameter A_WIDTH = 0;
+parameter B_WIDTH = 0;
+parameter Y_WIDTH = 0;
+input [A_WIDTH-1:0] A;
+input [B_WIDTH-1:0] B;
+output [Y_WIDTH-1:0] Y;
+endmodule
+
+module \$sshl (A, B, Y);
+parameter A_SIGNED = 0;
+parameter B_SIGNED = 0;
+parameter A_WIDTH = 0;
+parameter B_WIDTH = 0;
+parameter Y_WIDTH = 0;
+input [A_WIDTH-1:0] A;
+input [B_WIDTH-1:0] B;
+output [Y_WIDTH-1:0] Y;
+endmodule
+
+module \$sshr (A, B, Y);
+parameter A_SIGNED = 0;
+parameter B_SIGNED = 0;
+parameter A_WIDTH = 0;
+parameter B_WIDTH = 0;
+parameter Y_WIDTH = 0;
+input [A_WIDTH-1:0] A;
+input [B_WIDTH-1:0] B;
+output [Y_WIDTH-1:0] Y;
+endmodule
+
+module \$shift (A, B, Y);
+parameter A_SIGNED = 0;
+parameter B_SIGNED = 0;
+parameter A_WIDTH = 0;
+parameter B_WIDTH = 0;
+parameter Y_WIDTH = 0;
+input [A_WIDTH-1:0] A;
+input [B_WIDTH-1:0] B;
+output [Y_WIDTH-1:0] Y;
+endmodule
+
+module \$shiftx (A, B, Y);
+parameter A_SIGNED = 0;
+parameter B_SIGNED = 0;
+parameter A_WIDTH = 0;
+parameter B_WIDTH = 0;
+parameter Y_WIDTH = 0;
+input [A_WIDTH-1:0] A;
+input [B_WIDTH-1:0] B;
+output [Y_WIDTH-1:0] Y;
+endmodule
+
+module \$fa (A, B, C, X, Y);
+parameter WIDTH = 1;
+input [WIDTH-1:0] A, B, C;
+output [WIDTH-1:0] X, Y;
+endmodule
+
+module \$lcu (P, G, CI, CO);
+parameter WIDTH = 1;
+input [WIDTH-1:0] P, G;
+input CI;
+output [WIDTH-1:0] CO;
+endmodule
+
+module \$alu (A, B, CI, BI, X, Y, CO);
+parameter A_SIGNED = 0;
+parameter B_SIGNED = 0;
+parameter A_WIDTH = 1;
+parameter B_WIDTH = 1;
+parameter Y_WIDTH = 1;
+input [A_WIDTH-1:0] A;
+input [B_WIDTH-1:0] B;
+output [Y_WIDTH-1:0] X, Y;
+input CI, BI;
+output [Y_WIDTH-1:0] CO;
+endmodule
+
+module \$lt (A, B, Y);
+parameter A_SIGNED = 0;
+parameter B_SIGNED = 0;
+parameter A_WIDTH = 0;
+parameter B_WIDTH = 0;
+parameter Y_WIDTH = 0;
+input [A_WIDTH-1:0] A;
+input [B_WIDTH-1:0] B;
+output [Y_WIDTH-1:0] Y;
+endmodule
+
+module \$le (A, B, Y);
+parameter A_SIGNED = 0;
+parameter B_SIGNED = 0;
+parameter A_WIDTH = 0;
+parameter B_WIDTH = 0;
+parameter Y_WIDTH = 0;
+input [A_WIDTH-1:0] A;
+input [B_WIDTH-1:0] B;
+output [Y_WIDTH-1:0] Y;
+endmodule
+
+module \$eq (A, B, Y);
+parameter A_SIGNED = 0;
+parameter B_SIGNED = 0;
+parameter A_WIDTH = 0;
+parameter B_WIDTH = 0;
+parameter Y_WIDTH = 0;
+input [A_WIDTH-1:0] A;
+input [B_WIDTH-1:0] B;
+output [Y_WIDTH-1:0] Y;
+endmodule
+
+module \$ne (A, B, Y);
+parameter A_SIGNED = 0;
+parameter B_SIGNED = 0;
+parameter A_WIDTH = 0;
+parameter B_WIDTH = 0;
+parameter Y_WIDTH = 0;
+input [A_WIDTH-1:0] A;
+input [B_WIDTH-1:0] B;
+output [Y_WIDTH-1:0] Y;
+endmodule
+
+module \$eqx (A, B, Y);
+parameter A_SIGNED = 0;
+parameter B_SIGNED = 0;
+parameter A_WIDTH = 0;
+parameter B_WIDTH = 0;
+parameter Y_WIDTH = 0;
+input [A_WIDTH-1:0] A;
+input [B_WIDTH-1:0] B;
+output [Y_WIDTH-1:0] Y;
+endmodule
+
+module \$nex (A, B, Y);
+parameter A_SIGNED = 0;
+parameter B_SIGNED = 0;
+parameter A_WIDTH = 0;
+parameter B_WIDTH = 0;
+parameter Y_WIDTH = 0;
+input [A_WIDTH-1:0] A;
+input [B_WIDTH-1:0] B;
+output [Y_WIDTH-1:0] Y;
+endmodule
+
+module \$ge (A, B, Y);
+parameter A_SIGNED = 0;
+parameter B_SIGNED = 0;
+parameter A_WIDTH = 0;
+parameter B_WIDTH = 0;
+parameter Y_WIDTH = 0;
+input [A_WIDTH-1:0] A;
+input [B_WIDTH-1:0] B;
+output [Y_WIDTH-1:0] Y;
+endmodule
+
+module \$gt (A, B, Y);
+parameter A_SIGNED = 0;
+parameter B_SIGNED = 0;
+parameter A_WIDTH = 0;
+parameter B_WIDTH = 0;
+parameter Y_WIDTH = 0;
+input [A_WIDTH-1:0] A;
+input [B_WIDTH-1:0] B;
+output [Y_WIDTH-1:0] Y;
+endmodule
+
+module \$add (A, B, Y);
+parameter A_SIGNED = 0;
+parameter B_SIGNED = 0;
+parameter A_WIDTH = 0;
+parameter B_WIDTH = 0;
+parameter Y_WIDTH = 0;
+input [A_WIDTH-1:0] A;
+input [B_WIDTH-1:0] B;
+output [Y_WIDTH-1:0] Y;
+endmodule
+
+module \$sub (A, B, Y);
+parameter A_SIGNED = 0;
+parameter B_SIGNED = 0;
+parameter A_WIDTH = 0;
+parameter B_WIDTH = 0;
+parameter Y_WIDTH = 0;
+input [A_WIDTH-1:0] A;
+input [B_WIDTH-1:0] B;
+output [Y_WIDTH-1:0] Y;
+endmodule
+
+module \$mul (A, B, Y);
+parameter A_SIGNED = 0;
+parameter B_SIGNED = 0;
+parameter A_WIDTH = 0;
+parameter B_WIDTH = 0;
+parameter Y_WIDTH = 0;
+input [A_WIDTH-1:0] A;
+input [B_WIDTH-1:0] B;
+output [Y_WIDTH-1:0] Y;
+endmodule
+
+module \$macc (A, B, Y);
+parameter A_WIDTH = 0;
+parameter B_WIDTH = 0;
+parameter Y_WIDTH = 0;
+parameter CONFIG = 4'b0000;
+parameter CONFIG_WIDTH = 4;
+input [A_WIDTH-1:0] A;
+input [B_WIDTH-1:0] B;
+output [Y_WIDTH-1:0] Y;
+endmodule
+
+module \$div (A, B, Y);
+parameter A_SIGNED = 0;
+parameter B_SIGNED = 0;
+parameter A_WIDTH = 0;
+parameter B_WIDTH = 0;
+parameter Y_WIDTH = 0;
+input [A_WIDTH-1:0] A;
+input [B_WIDTH-1:0] B;
+output [Y_WIDTH-1:0] Y;
+endmodule
+
+module \$mod (A, B, Y);
+parameter A_SIGNED = 0;
+parameter B_SIGNED = 0;
+parameter A_WIDTH = 0;
+parameter B_WIDTH = 0;
+parameter Y_WIDTH = 0;
+input [A_WIDTH-1:0] A;
+input [B_WIDTH-1:0] B;
+output [Y_WIDTH-1:0] Y;
+endmodule
+
+module \$pow (A, B, Y);
+parameter A_SIGNED = 0;
+parameter B_SIGNED = 0;
+parameter A_WIDTH = 0;
+parameter B_WIDTH = 0;
+parameter Y_WIDTH = 0;
+input [A_WIDTH-1:0] A;
+input [B_WIDTH-1:0] B;
+output [Y_WIDTH-1:0] Y;
+endmodule
+
+module \$logic_not (A, Y);
+parameter A_SIGNED = 0;
+parameter A_WIDTH = 0;
+parameter Y_WIDTH = 0;
+input [A_WIDTH-1:0] A;
+output [Y_WIDTH-1:0] Y;
+endmodule
+
+module \$logic_and (A, B, Y);
+parameter A_SIGNED = 0;
+parameter B_SIGNED = 0;
+parameter A_WIDTH = 0;
+parameter B_WIDTH = 0;
+parameter Y_WIDTH = 0;
+input [A_WIDTH-1:0] A;
+input [B_WIDTH-1:0] B;
+output [Y_WIDTH-1:0] Y;
+endmodule
+
+module \$logic_or (A, B, Y);
+parameter A_SIGNED = 0;
+parameter B_SIGNED = 0;
+parameter A_WIDTH = 0;
+parameter B_WIDTH = 0;
+parameter Y_WIDTH = 0;
+input [A_WIDTH-1:0] A;
+input [B_WIDTH-1:0] B;
+output [Y_WIDTH-1:0] Y;
+endmodule
+
+module \$slice (A, Y);
+parameter OFFSET = 0;
+parameter A_WIDTH = 0;
+parameter Y_WIDTH = 0;
+input [A_WIDTH-1:0] A;
+output [Y_WIDTH-1:0] Y;
+endmodule
+
+module \$concat (A, B, Y);
+parameter A_WIDTH = 0;
+parameter B_WIDTH = 0;
+input [A_WIDTH-1:0] A;
+input [B_WIDTH-1:0] B;
+output [A_WIDTH+B_WIDTH-1:0] Y;
+endmodule
+
+module \$mux (A, B, S, Y);
+parameter WIDTH = 0;
+input [WIDTH-1:0] A, B;
+input S;
+output [WIDTH-1:0] Y;
+endmodule
+
+module \$pmux (A, B, S, Y);
+parameter WIDTH = 0;
+parameter S_WIDTH = 0;
+input [WIDTH-1:0] A;
+input [WIDTH*S_WIDTH-1:0] B;
+input [S_WIDTH-1:0] S;
+output [WIDTH-1:0] Y;
+endmodule
+
+module \$lut (A, Y);
+parameter WIDTH = 0;
+parameter LUT = 0;
+input [WIDTH-1:0] A;
+output Y;
+endmodule
+
+module \$assert (A, EN);
+input A, EN;
+endmodule
+
+module \$assume (A, EN);
+input A, EN;
+endmodule
+
+module \$equiv (A, B, Y);
+input A, B;
+output Y;
+endmodule
+
+module \$sr (SET, CLR, Q);
+parameter WIDTH = 0;
+parameter SET_POLARITY = 1'b1;
+parameter CLR_POLARITY = 1'b1;
+input [WIDTH-1:0] SET, CLR;
+output [WIDTH-1:0] Q;
+endmodule
+
+module \$dff (CLK, D, Q);
+parameter WIDTH = 0;
+parameter CLK_POLARITY = 1'b1;
+input CLK;
+input [WIDTH-1:0] D;
+output [WIDTH-1:0] Q;
+endmodule
+
+module \$dffe (CLK, EN, D, Q);
+parameter WIDTH = 0;
+parameter CLK_POLARITY = 1'b1;
+parameter EN_POLARITY = 1'b1;
+input CLK, EN;
+input [WIDTH-1:0] D;
+output [WIDTH-1:0] Q;
+endmodule
+
+module \$dffsr (CLK, SET, CLR, D, Q);
+parameter WIDTH = 0;
+parameter CLK_POLARITY = 1'b1;
+parameter SET_POLARITY = 1'b1;
+parameter CLR_POLARITY = 1'b1;
+input CLK;
+input [WIDTH-1:0] SET, CLR, D;
+output [WIDTH-1:0] Q;
+endmodule
+
+module \$adff (CLK, ARST, D, Q);
+parameter WIDTH = 0;
+parameter CLK_POLARITY = 1'b1;
+parameter ARST_POLARITY = 1'b1;
+parameter ARST_VALUE = 0;
+input CLK, ARST;
+input [WIDTH-1:0] D;
+output [WIDTH-1:0] Q;
+endmodule
+
+module \$dlatch (EN, D, Q);
+parameter WIDTH = 0;
+parameter EN_POLARITY = 1'b1;
+input EN;
+input [WIDTH-1:0] D;
+output [WIDTH-1:0] Q;
+endmodule
+
+module \$dlatchsr (EN, SET, CLR, D, Q);
+parameter WIDTH = 0;
+parameter EN_POLARITY = 1'b1;
+parameter SET_POLARITY = 1'b1;
+parameter CLR_POLARITY = 1'b1;
+input EN;
+input [WIDTH-1:0] SET, CLR, D;
+output [WIDTH-1:0] Q;
+endmodule
+
+module \$fsm (CLK, ARST, CTRL_IN, CTRL_OUT);
+parameter NAME = "";
+parameter CLK_POLARITY = 1'b1;
+parameter ARST_POLARITY = 1'b1;
+parameter CTRL_IN_WIDTH = 1;
+parameter CTRL_OUT_WIDTH = 1;
+parameter STATE_BITS = 1;
+parameter STATE_NUM = 1;
+parameter STATE_NUM_LOG2 = 1;
+parameter STATE_RST = 0;
+parameter STATE_TABLE = 1'b0;
+parameter TRANS_NUM = 1;
+parameter TRANS_TABLE = 4'b0x0x;
+input CLK, ARST;
+input [CTRL_IN_WIDTH-1:0] CTRL_IN;
+output [CTRL_OUT_WIDTH-1:0] CTRL_OUT;
+endmodule
+
+module \$memrd (CLK, ADDR, DATA);
+parameter MEMID = "";
+parameter ABITS = 8;
+parameter WIDTH = 8;
+parameter CLK_ENABLE = 0;
+parameter CLK_POLARITY = 0;
+parameter TRANSPARENT = 0;
+input CLK;
+input [ABITS-1:0] ADDR;
+output [WIDTH-1:0] DATA;
+endmodule
+
+module \$memwr (CLK, EN, ADDR, DATA);
+parameter MEMID = "";
+parameter ABITS = 8;
+parameter WIDTH = 8;
+parameter CLK_ENABLE = 0;
+parameter CLK_POLARITY = 0;
+parameter PRIORITY = 0;
+input CLK;
+input [WIDTH-1:0] EN;
+input [ABITS-1:0] ADDR;
+input [WIDTH-1:0] DATA;
+endmodule
+
+module \$meminit (ADDR, DATA);
+parameter MEMID = "";
+parameter ABITS = 8;
+parameter WIDTH = 8;
+parameter PRIORITY = 0;
+input [ABITS-1:0] ADDR;
+input [WIDTH-1:0] DATA;
+endmodule
+
+module \$mem (RD_CLK, RD_ADDR, RD_DATA, WR_CLK, WR_EN, WR_ADDR, WR_DATA);
+parameter MEMID = "";
+parameter signed SIZE = 4;
+parameter signed OFFSET = 0;
+parameter signed ABITS = 2;
+parameter signed WIDTH = 8;
+parameter signed INIT = 1'bx;
+parameter signed RD_PORTS = 1;
+parameter RD_CLK_ENABLE = 1'b1;
+parameter RD_CLK_POLARITY = 1'b1;
+parameter RD_TRANSPARENT = 1'b1;
+parameter signed WR_PORTS = 1;
+parameter WR_CLK_ENABLE = 1'b1;
+parameter WR_CLK_POLARITY = 1'b1;
+input [RD_PORTS-1:0] RD_CLK;
+input [RD_PORTS*ABITS-1:0] RD_ADDR;
+output [RD_PORTS*WIDTH-1:0] RD_DATA;
+input [WR_PORTS-1:0] WR_CLK;
+input [WR_PORTS*WIDTH-1:0] WR_EN;
+input [WR_PORTS*ABITS-1:0] WR_ADDR;
+input [WR_PORTS*WIDTH-1:0] WR_DATA;
+endmodule
+
+module  \$_BUF_ (A, Y);
+input A;
+output Y;
+endmodule
+
+module  \$_NOT_ (A, Y);
+input A;
+output Y;
+endmodule
+
+module  \$_AND_ (A, B, Y);
+input A, B;
+output Y;
+endmodule
+
+module  \$_NAND_ (A, B, Y);
+input A, B;
+output Y;
+endmodule
+
+module  \$_OR_ (A, B, Y);
+input A, B;
+output Y;
+endmodule
+
+module  \$_NOR_ (A, B, Y);
+input A, B;
+output Y;
+endmodule
+
+module  \$_XOR_ (A, B, Y);
+input A, B;
+output Y;
+endmodule
+
+module  \$_XNOR_ (A, B, Y);
+input A, B;
+output Y;
+endmodule
+
+module \$_MUX_ (A, B, S, Y);
+input A, B, S;
+output Y;
+endmodule
+
+module \$_MUX4_ (A, B, C, D, S, T, Y);
+input A, B, C, D, S, T;
+output Y;
+               (S ? B : A);
+endmodule
+
+module \$_MUX8_ (A, B, C, D, E, F, G, H, S, T, U, Y);
+input A, B, C, D, E, F, G, H, S, T, U;
+output Y;
+                   (S ? F : E) :
+               T ? (S ? D : C) :
+                   (S ? B : A);
+endmodule
+
+module \$_MUX16_ (A, B, C, D, E, F, G, H, I, J, K, L, M, N, O, P, S, T, U, V, Y);
+input A, B, C, D, E, F, G, H, I, J, K, L, M, N, O, P, S, T, U, V;
+output Y;
+                       (S ? N : M) :
+                   T ? (S ? L : K) :
+                       (S ? J : I) :
+               U ? T ? (S ? H : G) :
+                       (S ? F : E) :
+                   T ? (S ? D : C) :
+                       (S ? B : A);
+endmodule
+
+module  \$_AOI3_ (A, B, C, Y);
+input A, B, C;
+output Y;
+endmodule
+
+module  \$_OAI3_ (A, B, C, Y);
+input A, B, C;
+output Y;
+endmodule
+
+module  \$_AOI4_ (A, B, C, D, Y);
+input A, B, C, D;
+output Y;
+endmodule
+
+module  \$_OAI4_ (A, B, C, D, Y);
+input A, B, C, D;
+output Y;
+endmodule
+
+module  \$_SR_NN_ (S, R, Q);
+input S, R;
+output Q;
+endmodule
+
+module  \$_SR_NP_ (S, R, Q);
+input S, R;
+output Q;
+endmodule
+
+module  \$_SR_PN_ (S, R, Q);
+input S, R;
+output Q;
+endmodule
+
+module  \$_SR_PP_ (S, R, Q);
+input S, R;
+output Q;
+endmodule
+
+module  \$_DFF_N_ (D, Q, C);
+input D, C;
+output Q;
+endmodule
+
+module  \$_DFF_P_ (D, Q, C);
+input D, C;
+output Q;
+endmodule
+
+module  \$_DFFE_NN_ (D, Q, C, E);
+input D, C, E;
+output Q;
+endmodule
+
+module  \$_DFFE_NP_ (D, Q, C, E);
+input D, C, E;
+output Q;
+endmodule
+
+module  \$_DFFE_PN_ (D, Q, C, E);
+input D, C, E;
+output Q;
+endmodule
+
+module  \$_DFFE_PP_ (D, Q, C, E);
+input D, C, E;
+output Q;
+endmodule
+
+module  \$_DFF_NN0_ (D, Q, C, R);
+input D, C, R;
+output Q;
+endmodule
+
+module  \$_DFF_NN1_ (D, Q, C, R);
+input D, C, R;
+output Q;
+endmodule
+
+module  \$_DFF_NP0_ (D, Q, C, R);
+input D, C, R;
+output Q;
+endmodule
+
+module  \$_DFF_NP1_ (D, Q, C, R);
+input D, C, R;
+output Q;
+endmodule
+
+module  \$_DFF_PN0_ (D, Q, C, R);
+input D, C, R;
+output Q;
+endmodule
+
+module  \$_DFF_PN1_ (D, Q, C, R);
+input D, C, R;
+output Q;
+endmodule
+
+module  \$_DFF_PP0_ (D, Q, C, R);
+input D, C, R;
+output Q;
+endmodule
+
+module  \$_DFF_PP1_ (D, Q, C, R);
+input D, C, R;
+output Q;
+endmodule
+
+module  \$_DFFSR_NNN_ (C, S, R, D, Q);
+input C, S, R, D;
+output Q;
+endmodule
+
+module  \$_DFFSR_NNP_ (C, S, R, D, Q);
+input C, S, R, D;
+output Q;
+endmodule
+
+module  \$_DFFSR_NPN_ (C, S, R, D, Q);
+input C, S, R, D;
+output Q;
+endmodule
+
+module  \$_DFFSR_NPP_ (C, S, R, D, Q);
+input C, S, R, D;
+output Q;
+endmodule
+
+module  \$_DFFSR_PNN_ (C, S, R, D, Q);
+input C, S, R, D;
+output Q;
+endmodule
+
+module  \$_DFFSR_PNP_ (C, S, R, D, Q);
+input C, S, R, D;
+output Q;
+endmodule
+
+module  \$_DFFSR_PPN_ (C, S, R, D, Q);
+input C, S, R, D;
+output Q;
+endmodule
+
+module  \$_DFFSR_PPP_ (C, S, R, D, Q);
+input C, S, R, D;
+output Q;
+endmodule
+
+module  \$_DLATCH_N_ (E, D, Q);
+input E, D;
+output Q;
+endmodule
+
+module  \$_DLATCH_P_ (E, D, Q);
+input E, D;
+output Q;
+endmodule
+
+module  \$_DLATCHSR_NNN_ (E, S, R, D, Q);
+input E, S, R, D;
+output Q;
+endmodule
+
+module  \$_DLATCHSR_NNP_ (E, S, R, D, Q);
+input E, S, R, D;
+output Q;
+endmodule
+
+module  \$_DLATCHSR_NPN_ (E, S, R, D, Q);
+input E, S, R, D;
+output Q;
+endmodule
+
+module  \$_DLATCHSR_NPP_ (E, S, R, D, Q);
+input E, S, R, D;
+output Q;
+endmodule
+
+module  \$_DLATCHSR_PNN_ (E, S, R, D, Q);
+input E, S, R, D;
+output Q;
+endmodule
+
+module  \$_DLATCHSR_PNP_ (E, S, R, D, Q);
+input E, S, R, D;
+output Q;
+endmodule
+
+module  \$_DLATCHSR_PPN_ (E, S, R, D, Q);
+input E, S, R, D;
+output Q;
+endmodule
+
+module  \$_DLATCHSR_PPP_ (E, S, R, D, Q);
+input E, S, R, D;
+output Q;
+endmodule
+
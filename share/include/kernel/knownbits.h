@@ -0,0 +1,374 @@
+/*
+ *  yosys -- Yosys Open SYnthesis Suite
+ *
+ *  Copyright (C) 2012  Clifford Wolf <clifford@clifford.at>
+ *
+ *  Permission to use, copy, modify, and/or distribute this software for any
+ *  purpose with or without fee is hereby granted, provided that the above
+ *  copyright notice and this permission notice appear in all copies.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ *  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ *  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ *  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ *  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ *  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ *  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ *
+ */
+
+#ifndef KNOWNBITS_H
+#define KNOWNBITS_H
+
+#include "kernel/yosys.h"
+#include "kernel/sigtools.h"
+#include "kernel/celltypes.h"
+#include "kernel/modtools.h"
+
+YOSYS_NAMESPACE_BEGIN
+
+// Module-wide known-bits analysis: Starting from the constant drivers, the
+// values of all signal bits that can be derived from the semantics of the
+// combinational cells are propagated along the port database of a ModIndex
+// until a fixpoint is reached. A bit only ever changes from unknown to known,
+// so every cell is re-evaluated at most once per output bit that becomes known.
+//
+// The results are facts about the signals, not about the cells. So they stay
+// valid when a pass rewrites the module in a way that preserves its function.
+// Queries use the SigMap of the ModIndex, which is kept up to date by its
+// monitor. Bits whose nets have been merged since the analysis ran may be
+// reported as unknown, which is always safe.
+
+struct KnownBits
+{
+	typedef std::vector<RTLIL::State> bits_t;
+
+	ModIndex &mi;
+	SigMap &sigmap;
+	dict<RTLIL::SigBit, RTLIL::State> known_bits;
+
+	KnownBits(ModIndex &mi) : mi(mi), sigmap(mi.sigmap)
+	{
+		run();
+	}
+
+	// query methods
+
+	RTLIL::State value(RTLIL::SigBit bit) const
+	{
+		sigmap.apply(bit);
+		if (bit.wire == NULL)
+			return bit.data == RTLIL::S0 || bit.data == RTLIL::S1 ? bit.data : RTLIL::Sx;
+		auto it = known_bits.find(bit);
+		return it == known_bits.end() ? RTLIL::Sx : it->second;
+	}
+
+	bool is_known(RTLIL::SigBit bit) const
+	{
+		return value(bit) != RTLIL::Sx;
+	}
+
+	RTLIL::SigSpec apply(RTLIL::SigSpec sig) const
+	{
+		for (auto &bit : sig) {
+			RTLIL::State v = value(bit);
+			if (v != RTLIL::Sx)
+				bit = v;
+		}
+		return sig;
+	}
+
+	// number of bits needed to represent all values the signal can take,
+	// i.e. the width without the leading known-zero (unsigned) or redundant
+	// sign (signed) bits
+	int min_width(const RTLIL::SigSpec &sig, bool is_signed) const
+	{
+		int width = GetSize(sig);
+		if (is_signed) {
+			while (width > 1) {
+				RTLIL::State msb = value(sig[width-1]);
+				if (sig[width-1] != sig[width-2] && sigmap(sig[width-1]) != sigmap(sig[width-2]) &&
+						(msb == RTLIL::Sx || msb != value(sig[width-2])))
+					break;
+				width--;
+			}
+		} else {
+			while (width > 0 && value(sig[width-1]) == RTLIL::S0)
+				width--;
+		}
+		return width;
+	}
+
+	// ternary logic helpers
+
+	static RTLIL::State t_not(RTLIL::State a)
+	{
+		return a == RTLIL::S0 ? RTLIL::S1 : a == RTLIL::S1 ? RTLIL::S0 : RTLIL::Sx;
+	}
+
+	static RTLIL::State t_and(RTLIL::State a, RTLIL::State b)
+	{
+		if (a == RTLIL::S0 || b == RTLIL::S0)
+			return RTLIL::S0;
+		return a == RTLIL::S1 && b == RTLIL::S1 ? RTLIL::S1 : RTLIL::Sx;
+	}
+
+	static RTLIL::State t_or(RTLIL::State a, RTLIL::State b)
+	{
+		if (a == RTLIL::S1 || b == RTLIL::S1)
+			return RTLIL::S1;
+		return a == RTLIL::S0 && b == RTLIL::S0 ? RTLIL::S0 : RTLIL::Sx;
+	}
+
+	static RTLIL::State t_xor(RTLIL::State a, RTLIL::State b)
+	{
+		if (a == RTLIL::Sx || b == RTLIL::Sx)
+			return RTLIL::Sx;
+		return a != b ? RTLIL::S1 : RTLIL::S0;
+	}
+
+	static RTLIL::State t_mux(RTLIL::State a, RTLIL::State b, RTLIL::State s)
+	{
+		if (s == RTLIL::S0)
+			return a;
+		if (s == RTLIL::S1)
+			return b;
+		return a == b ? a : RTLIL::Sx;
+	}
+
+	// cell evaluation
+
+	bits_t get_bits(RTLIL::Cell *cell, RTLIL::IdString port, int width = -1, bool is_signed = false) const
+	{
+		RTLIL::SigSpec sig = cell->getPort(port);
+		if (width >= 0)
+			sig.extend_u0(width, is_signed);
+		bits_t bits;
+		for (auto bit : sig)
+			bits.push_back(value(bit));
+		return bits;
+	}
+
+	static bool fully_known(const bits_t &bits)
+	{
+		for (auto bit : bits)
+			if (bit == RTLIL::Sx)
+				return false;
+		return true;
+	}
+
+	static bits_t eval_add(const bits_t &a, const bits_t &b, RTLIL::State carry)
+	{
+		bits_t y(GetSize(a));
+		for (int i = 0; i < GetSize(a); i++) {
+			y[i] = t_xor(t_xor(a[i], b[i]), carry);
+			carry = t_or(t_and(a[i], b[i]), t_and(carry, t_or(a[i], b[i])));
+		}
+		return y;
+	}
+
+	bool eval_cell(RTLIL::Cell *cell, bits_t &y)
+	{
+		RTLIL::IdString type = cell->type;
+
+		if (!cell->hasPort("\\Y"))
+			return false;
+
+		int y_width = GetSize(cell->getPort("\\Y"));
+		bool a_signed = cell->parameters.count("\\A_SIGNED") && cell->getParam("\\A_SIGNED").as_bool();
+		bool b_signed = cell->parameters.count("\\B_SIGNED") && cell->getParam("\\B_SIGNED").as_bool();
+		bool is_signed = a_signed && b_signed;
+
+		if (type.in("$not", "$pos", "$neg", "$_NOT_", "$_BUF_"))
+		{
+			bits_t a = get_bits(cell, "\\A", y_width, a_signed);
+			if (type == "$neg") {
+				for (auto &bit : a)
+					bit = t_not(bit);
+				y = eval_add(a, bits_t(y_width, RTLIL::S0), RTLIL::S1);
+			} else {
+				y = a;
+				if (type.in("$not", "$_NOT_"))
+					for (auto &bit : y)
+						bit = t_not(bit);
+			}
+			return true;
+		}
+
+		if (type.in("$and", "$or", "$xor", "$xnor", "$add", "$sub",
+				"$_AND_", "$_NAND_", "$_OR_", "$_NOR_", "$_XOR_", "$_XNOR_"))
+		{
+			bits_t a = get_bits(cell, "\\A", y_width, is_signed);
+			bits_t b = get_bits(cell, "\\B", y_width, is_signed);
+
+			if (type == "$add")
+				y = eval_add(a, b, RTLIL::S0);
+			else if (type == "$sub") {
+				for (auto &bit : b)
+					bit = t_not(bit);
+				y = eval_add(a, b, RTLIL::S1);
+			} else {
+				y.resize(y_width);
+				for (int i = 0; i < y_width; i++) {
+					if (type.in("$and", "$_AND_", "$_NAND_"))
+						y[i] = t_and(a[i], b[i]);
+					else if (type.in("$or", "$_OR_", "$_NOR_"))
+						y[i] = t_or(a[i], b[i]);
+					else
+						y[i] = t_xor(a[i], b[i]);
+					if (type.in("$xnor", "$_NAND_", "$_NOR_", "$_XNOR_"))
+						y[i] = t_not(y[i]);
+				}
+			}
+			return true;
+		}
+
+		if (type.in("$mux", "$pmux", "$_MUX_"))
+		{
+			bits_t a = get_bits(cell, "\\A");
+			bits_t b = get_bits(cell, "\\B");
+			bits_t s = get_bits(cell, "\\S");
+
+			y = a;
+			if (type != "$pmux") {
+				for (int i = 0; i < y_width; i++)
+					y[i] = t_mux(a[i], b[i], s[0]);
+				return true;
+			}
+
+			// the result can only be known if all inputs that may be
+			// selected agree on the value
+			for (int k = 0; k < GetSize(s); k++) {
+				if (s[k] == RTLIL::S0)
+					continue;
+				for (int i = 0; i < y_width; i++)
+					y[i] = y[i] == b[k*y_width + i] ? y[i] : RTLIL::Sx;
+				if (s[k] == RTLIL::S1) {
+					// a known active port overrides the default input
+					bits_t y_b(b.begin() + k*y_width, b.begin() + (k+1)*y_width);
+					for (int j = 0; j < GetSize(s); j++)
+						if (j != k && s[j] != RTLIL::S0)
+							for (int i = 0; i < y_width; i++)
+								y_b[i] = y_b[i] == b[j*y_width + i] ? y_b[i] : RTLIL::Sx;
+					y = y_b;
+					break;
+				}
+			}
+			return true;
+		}
+
+		if (type.in("$reduce_and", "$reduce_or", "$reduce_bool", "$logic_not", "$reduce_xor", "$reduce_xnor",
+				"$logic_and", "$logic_or", "$eq", "$ne", "$eqx", "$nex"))
+		{
+			RTLIL::State result = RTLIL::Sx;
+
+			if (type.in("$eq", "$ne", "$eqx", "$nex"))
+			{
+				int width = std::max(GetSize(cell->getPort("\\A")), GetSize(cell->getPort("\\B")));
+				bits_t a = get_bits(cell, "\\A", width, is_signed);
+				bits_t b = get_bits(cell, "\\B", width, is_signed);
+				result = RTLIL::S1;
+				for (int i = 0; i < width; i++)
+					result = t_and(result, t_not(t_xor(a[i], b[i])));
+				if (type.in("$ne", "$nex"))
+					result = t_not(result);
+			}
+			else
+			{
+				bits_t a = get_bits(cell, "\\A");
+				result = type == "$reduce_and" ? RTLIL::S1 : RTLIL::S0;
+				for (auto bit : a) {
+					if (type == "$reduce_and")
+						result = t_and(result, bit);
+					else if (type.in("$reduce_xor", "$reduce_xnor"))
+						result = t_xor(result, bit);
+					else
+						result = t_or(result, bit);
+				}
+				if (type.in("$logic_and", "$logic_or")) {
+					RTLIL::State result_b = RTLIL::S0;
+					for (auto bit : get_bits(cell, "\\B"))
+						result_b = t_or(result_b, bit);
+					result = type == "$logic_and" ? t_and(result, result_b) : t_or(result, result_b);
+				}
+				if (type.in("$logic_not", "$reduce_xnor"))
+					result = t_not(result);
+			}
+
+			y = bits_t(y_width, RTLIL::S0);
+			if (y_width > 0)
+				y[0] = result;
+			return true;
+		}
+
+		// the remaining cells are only evaluated if all inputs are known
+
+		if (!type.in("$shl", "$shr", "$sshl", "$sshr", "$shift", "$shiftx", "$lt", "$le", "$ge", "$gt",
+				"$mul", "$div", "$mod", "$pow", "$slice", "$concat", "$lut"))
+			return false;
+
+		RTLIL::Const arg1, arg2;
+		for (auto &conn : cell->connections()) {
+			if (conn.first == "\\Y")
+				continue;
+			if (conn.first != "\\A" && conn.first != "\\B")
+				return false;
+			bits_t bits = get_bits(cell, conn.first);
+			if (!fully_known(bits))
+				return false;
+			(conn.first == "\\A" ? arg1 : arg2) = RTLIL::Const(bits);
+		}
+
+		y = CellTypes::eval(cell, arg1, arg2).bits;
+		y.resize(y_width, RTLIL::Sx);
+		for (auto &bit : y)
+			if (bit != RTLIL::S0 && bit != RTLIL::S1)
+				bit = RTLIL::Sx;
+		return true;
+	}
+
+	void run()
+	{
+		std::vector<RTLIL::Cell*> worklist;
+		pool<RTLIL::Cell*> queued;
+
+		if (mi.auto_reload_module)
+			mi.reload_module();
+
+		for (auto cell : mi.module->cells())
+			if (cell->hasPort("\\Y")) {
+				worklist.push_back(cell);
+				queued.insert(cell);
+			}
+
+		while (!worklist.empty())
+		{
+			RTLIL::Cell *cell = worklist.back();
+			worklist.pop_back();
+			queued.erase(cell);
+
+			bits_t y;
+			if (!eval_cell(cell, y))
+				continue;
+
+			RTLIL::SigSpec sig_y = sigmap(cell->getPort("\\Y"));
+			for (int i = 0; i < GetSize(sig_y); i++)
+			{
+				if (sig_y[i].wire == NULL || y[i] == RTLIL::Sx || known_bits.count(sig_y[i]))
+					continue;
+
+				known_bits[sig_y[i]] = y[i];
+
+				for (auto &port : mi.query_ports(sig_y[i]))
+					if (port.port != "\\Y" && !queued.count(port.cell) && port.cell->hasPort("\\Y")) {
+						worklist.push_back(port.cell);
+						queued.insert(port.cell);
+					}
+			}
+		}
+	}
+};
+
+YOSYS_NAMESPACE_END
+
+#endif